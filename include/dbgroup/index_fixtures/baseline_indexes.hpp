@@ -0,0 +1,2029 @@
+/*
+ * Copyright 2026 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_INDEX_FIXTURES_BASELINE_INDEXES_HPP
+#define DBGROUP_INDEX_FIXTURES_BASELINE_INDEXES_HPP
+
+// C++ standard libraries
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <shared_mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// external C++ libraries
+#include <dbgroup/index/utility.hpp>
+
+// local sources
+#include "common.hpp"
+#include "concepts.hpp"
+
+namespace dbgroup::index::test
+{
+/*############################################################################*
+ * Utility functions for baseline indexes
+ *############################################################################*/
+
+/**
+ * @param begin_key An optional begin key.
+ * @param end_key An optional end key.
+ * @retval true if the given range cannot contain any key.
+ * @retval false otherwise.
+ */
+template <class Key, class Comp>
+auto
+IsEmptyRange(  //
+    const std::optional<std::tuple<Key, size_t, bool>>& begin_key,
+    const std::optional<std::tuple<Key, size_t, bool>>& end_key)  //
+    -> bool
+{
+  if (!begin_key || !end_key) return false;
+
+  const auto& [b_key, b_len, b_closed] = *begin_key;
+  const auto& [e_key, e_len, e_closed] = *end_key;
+  if (Comp{}(e_key, b_key)) return true;
+  return !Comp{}(b_key, e_key) && !(b_closed && e_closed);
+}
+
+/*############################################################################*
+ * Baseline index implementations
+ *############################################################################*/
+
+/**
+ * @brief A baseline index using hash-partitioned `std::map`s.
+ *
+ * Each shard is protected by `std::shared_mutex`. An iterator holds shared
+ * locks of all the shards until it is destructed, and so scans always read a
+ * consistent snapshot.
+ *
+ * @tparam Key A class of stored keys.
+ * @tparam Payload A class of stored payloads.
+ * @tparam Comp A comparator for keys.
+ */
+template <class Key, class Payload, class Comp>
+class ShardedMapIndex
+{
+  /*##########################################################################*
+   * Type aliases
+   *##########################################################################*/
+
+  using Map = std::map<Key, Payload, Comp>;
+  using MapIter = typename Map::const_iterator;
+  using ScanKey = std::optional<std::tuple<Key, size_t, bool>>;
+  using MergeFn = Payload (*)(const Payload&, const Payload&);
+
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  static constexpr size_t kShardNum = 16;
+
+  /*##########################################################################*
+   * Internal classes
+   *##########################################################################*/
+
+  /// @brief A shard padded for avoiding false sharing.
+  struct alignas(kCacheLineSize) Shard {
+    std::shared_mutex mtx{};
+    Map map{};
+  };
+
+ public:
+  /*##########################################################################*
+   * Public constants
+   *##########################################################################*/
+
+  /// @brief Reads and scans can run during bulkloading (each shard is locked).
+  static constexpr bool kOnlineBulkload = true;
+
+  /*##########################################################################*
+   * Public classes
+   *##########################################################################*/
+
+  /**
+   * @brief An iterator for merging sorted records in all the shards.
+   *
+   * @tparam kReverse A flag for scanning in descending order.
+   */
+  template <bool kReverse>
+  class RecordIterator
+  {
+    using Iter = std::conditional_t<kReverse, std::reverse_iterator<MapIter>, MapIter>;
+
+   public:
+    RecordIterator() = default;
+
+    RecordIterator(  //
+        std::array<Shard, kShardNum>& shards,
+        const ScanKey& begin_key,
+        const ScanKey& end_key)
+    {
+      guards_.reserve(kShardNum);
+      heads_.reserve(kShardNum);
+      const auto is_empty = IsEmptyRange<Key, Comp>(begin_key, end_key);
+      for (auto&& shard : shards) {
+        guards_.emplace_back(shard.mtx);
+        if (is_empty) continue;
+
+        const auto [lo, hi] = GetRange(shard.map, begin_key, end_key);
+        if constexpr (kReverse) {
+          heads_.emplace_back(Iter{hi}, Iter{lo});
+        } else {
+          heads_.emplace_back(lo, hi);
+        }
+      }
+      SelectHead();
+    }
+
+    RecordIterator(const RecordIterator&) = delete;
+    RecordIterator(RecordIterator&&) noexcept = default;
+
+    auto operator=(const RecordIterator&) -> RecordIterator& = delete;
+    auto operator=(RecordIterator&&) noexcept -> RecordIterator& = default;
+
+    ~RecordIterator() = default;
+
+    explicit
+    operator bool() const noexcept
+    {
+      return cur_ < heads_.size();
+    }
+
+    auto
+    operator*() const  //
+        -> std::pair<Key, Payload>
+    {
+      const auto& [key, payload] = *(heads_[cur_].first);
+      return {key, payload};
+    }
+
+    void
+    operator++()
+    {
+      ++(heads_[cur_].first);
+      SelectHead();
+    }
+
+    constexpr void
+    PrepareVerifier() const noexcept
+    {
+    }
+
+    [[nodiscard]] constexpr auto
+    VerifySnapshot() const noexcept  //
+        -> bool
+    {
+      return true;  // all the shards are locked while scanning
+    }
+
+    [[nodiscard]] constexpr auto
+    VerifyNoPhantom() const noexcept  //
+        -> bool
+    {
+      return true;  // all the shards are locked while scanning
+    }
+
+   private:
+    void
+    SelectHead()
+    {
+      constexpr Comp kComp{};
+
+      cur_ = heads_.size();
+      for (size_t i = 0; i < heads_.size(); ++i) {
+        const auto& [it, end] = heads_[i];
+        if (it == end) continue;
+        if (cur_ == heads_.size()) {
+          cur_ = i;
+          continue;
+        }
+
+        const auto& cur_key = heads_[cur_].first->first;
+        if (kReverse ? kComp(cur_key, it->first) : kComp(it->first, cur_key)) {
+          cur_ = i;
+        }
+      }
+    }
+
+    /// @brief Shared locks of all the shards.
+    std::vector<std::shared_lock<std::shared_mutex>> guards_{};
+
+    /// @brief The current/end positions in each shard.
+    std::vector<std::pair<Iter, Iter>> heads_{};
+
+    /// @brief The position of the shard that has the current record.
+    size_t cur_{};
+  };
+
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  ShardedMapIndex() = default;
+
+  ShardedMapIndex(const ShardedMapIndex&) = delete;
+  ShardedMapIndex(ShardedMapIndex&&) = delete;
+
+  auto operator=(const ShardedMapIndex&) -> ShardedMapIndex& = delete;
+  auto operator=(ShardedMapIndex&&) -> ShardedMapIndex& = delete;
+
+  ~ShardedMapIndex() = default;
+
+  /*##########################################################################*
+   * Public read APIs
+   *##########################################################################*/
+
+  auto
+  Read(  //
+      const Key& key,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    auto& shard = GetShard(key);
+    const std::shared_lock guard{shard.mtx};
+    const auto it = shard.map.find(key);
+    if (it == shard.map.end()) return std::nullopt;
+    return it->second;
+  }
+
+  auto
+  Scan(  //
+      const ScanKey& begin_key = std::nullopt,
+      const ScanKey& end_key = std::nullopt)  //
+      -> RecordIterator<false>
+  {
+    return RecordIterator<false>{shards_, begin_key, end_key};
+  }
+
+  auto
+  ScanBackward(  //
+      const ScanKey& begin_key = std::nullopt,
+      const ScanKey& end_key = std::nullopt)  //
+      -> RecordIterator<true>
+  {
+    return RecordIterator<true>{shards_, begin_key, end_key};
+  }
+
+  /*##########################################################################*
+   * Public write APIs
+   *##########################################################################*/
+
+  void
+  Write(  //
+      const Key& key,
+      const Payload& payload,
+      [[maybe_unused]] const size_t key_len = sizeof(Key),
+      const MergeFn merge = nullptr)
+  {
+    auto& shard = GetShard(key);
+    const std::lock_guard guard{shard.mtx};
+    auto [it, inserted] = shard.map.try_emplace(key, payload);
+    if (!inserted) {
+      it->second = (merge == nullptr) ? payload : merge(it->second, payload);
+    }
+  }
+
+  auto
+  Upsert(  //
+      const Key& key,
+      const Payload& payload,
+      [[maybe_unused]] const size_t key_len = sizeof(Key),
+      const MergeFn merge = nullptr)  //
+      -> std::optional<Payload>
+  {
+    auto& shard = GetShard(key);
+    const std::lock_guard guard{shard.mtx};
+    auto [it, inserted] = shard.map.try_emplace(key, payload);
+    if (inserted) return std::nullopt;
+
+    const auto old = it->second;
+    it->second = (merge == nullptr) ? payload : merge(old, payload);
+    return old;
+  }
+
+  auto
+  Insert(  //
+      const Key& key,
+      const Payload& payload,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    auto& shard = GetShard(key);
+    const std::lock_guard guard{shard.mtx};
+    const auto [it, inserted] = shard.map.try_emplace(key, payload);
+    if (!inserted) return it->second;
+    return std::nullopt;
+  }
+
+  auto
+  Update(  //
+      const Key& key,
+      const Payload& payload,
+      [[maybe_unused]] const size_t key_len = sizeof(Key),
+      const MergeFn merge = nullptr,
+      [[maybe_unused]] const size_t pay_len = sizeof(Payload))  //
+      -> std::optional<Payload>
+  {
+    auto& shard = GetShard(key);
+    const std::lock_guard guard{shard.mtx};
+    const auto it = shard.map.find(key);
+    if (it == shard.map.end()) return std::nullopt;
+
+    const auto old = it->second;
+    it->second = (merge == nullptr) ? payload : merge(old, payload);
+    return old;
+  }
+
+  /**
+   * @param key A target key.
+   * @param expected An expected payload of the key.
+   * @param desired A payload written only if the current one is expected.
+   * @param key_len The length of the key.
+   * @return The payload before this operation if the key exists.
+   */
+  auto
+  CompareAndSwap(  //
+      const Key& key,
+      const Payload& expected,
+      const Payload& desired,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    auto& shard = GetShard(key);
+    const std::lock_guard guard{shard.mtx};
+    const auto it = shard.map.find(key);
+    if (it == shard.map.end()) return std::nullopt;
+
+    const auto old = it->second;
+    if (old == expected) {
+      it->second = desired;
+    }
+    return old;
+  }
+
+  auto
+  Delete(  //
+      const Key& key,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    auto& shard = GetShard(key);
+    const std::lock_guard guard{shard.mtx};
+    const auto it = shard.map.find(key);
+    if (it == shard.map.end()) return std::nullopt;
+
+    const auto old = it->second;
+    shard.map.erase(it);
+    return old;
+  }
+
+  /**
+   * @brief Delete all the records in a given range atomically.
+   *
+   * @param begin_key An optional begin key.
+   * @param end_key An optional end key.
+   * @return The number of deleted records.
+   */
+  auto
+  DeleteRange(  //
+      const ScanKey& begin_key,
+      const ScanKey& end_key)  //
+      -> size_t
+  {
+    if (IsEmptyRange<Key, Comp>(begin_key, end_key)) return 0;
+
+    std::vector<std::unique_lock<std::shared_mutex>> guards{};
+    guards.reserve(kShardNum);
+    for (auto&& shard : shards_) {
+      guards.emplace_back(shard.mtx);
+    }
+    size_t cnt = 0;
+    for (auto&& shard : shards_) {
+      const auto [lo, hi] = GetRange(shard.map, begin_key, end_key);
+      cnt += std::distance(lo, hi);
+      shard.map.erase(lo, hi);
+    }
+    return cnt;
+  }
+
+  /**
+   * @brief Bulkload sorted entries, building each shard in parallel.
+   *
+   * @tparam Entries A random-access range of entries (e.g., `std::vector` or
+   * `BulkloadInput`).
+   * @param entries Sorted entries of keys, payloads, and key lengths.
+   * @param thread_num The number of threads for building shards.
+   */
+  template <class Entries>
+  void
+  Bulkload(  //
+      const Entries& entries,
+      const size_t thread_num = 1)
+  {
+    const auto t_num = std::max<size_t>(thread_num, 1);
+    std::array<std::vector<size_t>, kShardNum> partitions{};
+    for (size_t i = 0; i < entries.size(); ++i) {
+      partitions[HashKey(std::get<0>(entries[i])) % kShardNum].emplace_back(i);
+    }
+
+    auto build = [&](const size_t t_id) {
+      for (size_t s = t_id; s < kShardNum; s += t_num) {
+        auto& shard = shards_[s];
+        const std::lock_guard guard{shard.mtx};
+        for (const auto i : partitions[s]) {
+          const auto& [key, payload, _] = entries[i];
+          shard.map.emplace_hint(shard.map.end(), key, payload);
+        }
+      }
+    };
+
+    std::vector<std::thread> threads{};
+    for (size_t i = 1; i < t_num; ++i) {
+      threads.emplace_back(build, i);
+    }
+    build(0);
+    for (auto&& t : threads) {
+      t.join();
+    }
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal utilities
+   *##########################################################################*/
+
+  auto
+  GetShard(  //
+      const Key& key)  //
+      -> Shard&
+  {
+    return shards_[HashKey(key) % kShardNum];
+  }
+
+  /**
+   * @param map A target map.
+   * @param begin_key An optional begin key.
+   * @param end_key An optional end key.
+   * @return The begin/end positions of the given range in the map.
+   */
+  static auto
+  GetRange(  //
+      const Map& map,
+      const ScanKey& begin_key,
+      const ScanKey& end_key)  //
+      -> std::pair<MapIter, MapIter>
+  {
+    auto lo = map.cbegin();
+    if (begin_key) {
+      const auto& [key, _, closed] = *begin_key;
+      lo = closed ? map.lower_bound(key) : map.upper_bound(key);
+    }
+    auto hi = map.cend();
+    if (end_key) {
+      const auto& [key, _, closed] = *end_key;
+      hi = closed ? map.upper_bound(key) : map.lower_bound(key);
+    }
+    return {lo, hi};
+  }
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief Hash-partitioned ordered maps.
+  std::array<Shard, kShardNum> shards_{};
+};
+
+/**
+ * @brief A baseline index using a single sorted array.
+ *
+ * This index is built by bulkloading and only supports in-place updates
+ * afterward, i.e., it represents the ideal read/scan performance of an
+ * ordered index without any structure modification.
+ *
+ * @tparam Key A class of stored keys.
+ * @tparam Payload A class of stored payloads.
+ * @tparam Comp A comparator for keys.
+ */
+template <class Key, class Payload, class Comp>
+class SortedArrayIndex
+{
+  /*##########################################################################*
+   * Type aliases
+   *##########################################################################*/
+
+  using Record = std::pair<Key, Payload>;
+  using ScanKey = std::optional<std::tuple<Key, size_t, bool>>;
+  using MergeFn = Payload (*)(const Payload&, const Payload&);
+
+ public:
+  /*##########################################################################*
+   * Public constants
+   *##########################################################################*/
+
+  /// @brief Reads and scans can run during bulkloading (a new array is swapped in).
+  static constexpr bool kOnlineBulkload = true;
+
+  /*##########################################################################*
+   * Public classes
+   *##########################################################################*/
+
+  /**
+   * @brief An iterator for reading a contiguous range of records.
+   *
+   * @tparam kReverse A flag for scanning in descending order.
+   */
+  template <bool kReverse>
+  class RecordIterator
+  {
+   public:
+    RecordIterator() = default;
+
+    RecordIterator(  //
+        std::shared_lock<std::shared_mutex>&& guard,
+        const std::vector<Record>& records,
+        const size_t begin_pos,
+        const size_t end_pos)
+        : guard_{std::move(guard)}
+        , records_{&records}
+        , cur_{kReverse ? end_pos : begin_pos}
+        , end_{kReverse ? begin_pos : end_pos}
+    {
+    }
+
+    RecordIterator(const RecordIterator&) = delete;
+    RecordIterator(RecordIterator&&) noexcept = default;
+
+    auto operator=(const RecordIterator&) -> RecordIterator& = delete;
+    auto operator=(RecordIterator&&) noexcept -> RecordIterator& = default;
+
+    ~RecordIterator() = default;
+
+    explicit
+    operator bool() const noexcept
+    {
+      return kReverse ? cur_ > end_ : cur_ < end_;
+    }
+
+    auto
+    operator*() const  //
+        -> std::pair<Key, Payload>
+    {
+      return (*records_)[kReverse ? cur_ - 1 : cur_];
+    }
+
+    void
+    operator++() noexcept
+    {
+      if constexpr (kReverse) {
+        --cur_;
+      } else {
+        ++cur_;
+      }
+    }
+
+    constexpr void
+    PrepareVerifier() const noexcept
+    {
+    }
+
+    [[nodiscard]] constexpr auto
+    VerifySnapshot() const noexcept  //
+        -> bool
+    {
+      return true;  // the array is locked while scanning
+    }
+
+    [[nodiscard]] constexpr auto
+    VerifyNoPhantom() const noexcept  //
+        -> bool
+    {
+      return true;  // the array is locked while scanning
+    }
+
+   private:
+    /// @brief A shared lock of the array.
+    std::shared_lock<std::shared_mutex> guard_{};
+
+    /// @brief The target records.
+    const std::vector<Record>* records_{};
+
+    /// @brief The current position.
+    size_t cur_{};
+
+    /// @brief The end position.
+    size_t end_{};
+  };
+
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  SortedArrayIndex() = default;
+
+  SortedArrayIndex(const SortedArrayIndex&) = delete;
+  SortedArrayIndex(SortedArrayIndex&&) = delete;
+
+  auto operator=(const SortedArrayIndex&) -> SortedArrayIndex& = delete;
+  auto operator=(SortedArrayIndex&&) -> SortedArrayIndex& = delete;
+
+  ~SortedArrayIndex() = default;
+
+  /*##########################################################################*
+   * Public read APIs
+   *##########################################################################*/
+
+  auto
+  Read(  //
+      const Key& key,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    const std::shared_lock guard{mtx_};
+    const auto pos = Find(key);
+    if (!pos) return std::nullopt;
+    return records_[*pos].second;
+  }
+
+  auto
+  Scan(  //
+      const ScanKey& begin_key = std::nullopt,
+      const ScanKey& end_key = std::nullopt)  //
+      -> RecordIterator<false>
+  {
+    std::shared_lock guard{mtx_};
+    const auto [begin_pos, end_pos] = GetRange(begin_key, end_key);
+    return RecordIterator<false>{std::move(guard), records_, begin_pos, end_pos};
+  }
+
+  auto
+  ScanBackward(  //
+      const ScanKey& begin_key = std::nullopt,
+      const ScanKey& end_key = std::nullopt)  //
+      -> RecordIterator<true>
+  {
+    std::shared_lock guard{mtx_};
+    const auto [begin_pos, end_pos] = GetRange(begin_key, end_key);
+    return RecordIterator<true>{std::move(guard), records_, begin_pos, end_pos};
+  }
+
+  /**
+   * @param prefix A prefix of target keys.
+   * @param prefix_len The length of the prefix without a terminal character.
+   * @return An iterator of the records whose keys start with the prefix.
+   */
+  auto
+  ScanPrefix(  //
+      const Key& prefix,
+      const size_t prefix_len)  //
+      -> RecordIterator<false>
+    requires(IsVarLenData<Key>())
+  {
+    std::shared_lock guard{mtx_};
+    const auto begin_pos = LowerBound(prefix);
+    const auto it = std::partition_point(
+        std::next(records_.begin(), begin_pos), records_.end(),
+        [&](const Record& rec) { return std::strncmp(rec.first, prefix, prefix_len) == 0; });
+    const auto end_pos = static_cast<size_t>(std::distance(records_.begin(), it));
+    return RecordIterator<false>{std::move(guard), records_, begin_pos, end_pos};
+  }
+
+  /*##########################################################################*
+   * Public write APIs
+   *##########################################################################*/
+
+  auto
+  Update(  //
+      const Key& key,
+      const Payload& payload,
+      [[maybe_unused]] const size_t key_len = sizeof(Key),
+      const MergeFn merge = nullptr,
+      [[maybe_unused]] const size_t pay_len = sizeof(Payload))  //
+      -> std::optional<Payload>
+  {
+    const std::lock_guard guard{mtx_};
+    const auto pos = Find(key);
+    if (!pos) return std::nullopt;
+
+    auto& cur = records_[*pos].second;
+    const auto old = cur;
+    cur = (merge == nullptr) ? payload : merge(old, payload);
+    return old;
+  }
+
+  /**
+   * @param key A target key.
+   * @param expected An expected payload of the key.
+   * @param desired A payload written only if the current one is expected.
+   * @param key_len The length of the key.
+   * @return The payload before this operation if the key exists.
+   */
+  auto
+  CompareAndSwap(  //
+      const Key& key,
+      const Payload& expected,
+      const Payload& desired,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    const std::lock_guard guard{mtx_};
+    const auto pos = Find(key);
+    if (!pos) return std::nullopt;
+
+    auto& cur = records_[*pos].second;
+    const auto old = cur;
+    if (old == expected) {
+      cur = desired;
+    }
+    return old;
+  }
+
+  /**
+   * @brief Replace all the records with the given ones.
+   *
+   * @tparam Entries A random-access range of entries (e.g., `std::vector` or
+   * `BulkloadInput`).
+   * @param entries Entries of keys, payloads, and key lengths.
+   * @param thread_num The number of threads for copying entries.
+   */
+  template <class Entries>
+  void
+  Bulkload(  //
+      const Entries& entries,
+      const size_t thread_num = 1)
+  {
+    const auto t_num = std::max<size_t>(thread_num, 1);
+
+    // build a new array without locks, and then swap it in
+    const auto n = entries.size();
+    std::vector<Record> records(n);
+    auto copy = [&](const size_t t_id) {
+      const auto begin = n * t_id / t_num;
+      const auto end = n * (t_id + 1) / t_num;
+      for (size_t i = begin; i < end; ++i) {
+        const auto& [key, payload, _] = entries[i];
+        records[i] = {key, payload};
+      }
+    };
+
+    std::vector<std::thread> threads{};
+    for (size_t i = 1; i < t_num; ++i) {
+      threads.emplace_back(copy, i);
+    }
+    copy(0);
+    for (auto&& t : threads) {
+      t.join();
+    }
+
+    constexpr auto kLess = [](const Record& lhs, const Record& rhs) {
+      return Comp{}(lhs.first, rhs.first);
+    };
+    if (!std::is_sorted(records.begin(), records.end(), kLess)) {
+      std::sort(records.begin(), records.end(), kLess);
+    }
+
+    const std::lock_guard guard{mtx_};
+    records_.swap(records);
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal utilities
+   *##########################################################################*/
+
+  [[nodiscard]] auto
+  LowerBound(  //
+      const Key& key) const  //
+      -> size_t
+  {
+    const auto it = std::lower_bound(
+        records_.begin(), records_.end(), key,
+        [](const Record& rec, const Key& k) { return Comp{}(rec.first, k); });
+    return std::distance(records_.begin(), it);
+  }
+
+  [[nodiscard]] auto
+  UpperBound(  //
+      const Key& key) const  //
+      -> size_t
+  {
+    const auto it = std::upper_bound(
+        records_.begin(), records_.end(), key,
+        [](const Key& k, const Record& rec) { return Comp{}(k, rec.first); });
+    return std::distance(records_.begin(), it);
+  }
+
+  [[nodiscard]] auto
+  Find(  //
+      const Key& key) const  //
+      -> std::optional<size_t>
+  {
+    const auto pos = LowerBound(key);
+    if (pos == records_.size() || Comp{}(key, records_[pos].first)) return std::nullopt;
+    return pos;
+  }
+
+  [[nodiscard]] auto
+  GetRange(  //
+      const ScanKey& begin_key,
+      const ScanKey& end_key) const  //
+      -> std::pair<size_t, size_t>
+  {
+    if (IsEmptyRange<Key, Comp>(begin_key, end_key)) return {0, 0};
+
+    size_t begin_pos = 0;
+    if (begin_key) {
+      const auto& [key, _, closed] = *begin_key;
+      begin_pos = closed ? LowerBound(key) : UpperBound(key);
+    }
+    size_t end_pos = records_.size();
+    if (end_key) {
+      const auto& [key, _, closed] = *end_key;
+      end_pos = closed ? UpperBound(key) : LowerBound(key);
+    }
+    return {begin_pos, end_pos};
+  }
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief A mutex for protecting records.
+  std::shared_mutex mtx_{};
+
+  /// @brief Sorted records.
+  std::vector<Record> records_{};
+};
+
+/**
+ * @brief A baseline hash index using open addressing with linear probing.
+ *
+ * This index does not support scans. The entire table is protected by
+ * `std::shared_mutex`, and it doubles its capacity if the ratio of used slots
+ * (including tombstones) exceeds `kMaxLoadFactor`. It exposes its hash function
+ * and load factor and reports each resize for the hash-index fixture.
+ *
+ * @tparam Key A class of stored keys.
+ * @tparam Payload A class of stored payloads.
+ * @tparam Comp A comparator for keys.
+ */
+template <class Key, class Payload, class Comp>
+class OpenAddressingIndex
+{
+  /*##########################################################################*
+   * Type aliases
+   *##########################################################################*/
+
+  using MergeFn = Payload (*)(const Payload&, const Payload&);
+
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  static constexpr size_t kInitCapacity = 1024;
+  static constexpr double kMaxLoadFactor = 0.5;
+
+  /*##########################################################################*
+   * Internal classes
+   *##########################################################################*/
+
+  /// @brief States of each slot.
+  enum SlotState : uint8_t {
+    kEmpty,
+    kOccupied,
+    kDeleted,
+  };
+
+  /// @brief A slot of a hash table.
+  struct Slot {
+    Key key{};
+    Payload payload{};
+    SlotState state{kEmpty};
+  };
+
+ public:
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  OpenAddressingIndex() = default;
+
+  OpenAddressingIndex(const OpenAddressingIndex&) = delete;
+  OpenAddressingIndex(OpenAddressingIndex&&) = delete;
+
+  auto operator=(const OpenAddressingIndex&) -> OpenAddressingIndex& = delete;
+  auto operator=(OpenAddressingIndex&&) -> OpenAddressingIndex& = delete;
+
+  ~OpenAddressingIndex() = default;
+
+  /*##########################################################################*
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @param key A target key.
+   * @return The hash value used for probing the table.
+   */
+  static auto
+  GetHash(                      //
+      const Key& key) noexcept  //
+      -> size_t
+  {
+    return HashKey(key);
+  }
+
+  /**
+   * @return The ratio of used slots (including tombstones).
+   */
+  auto
+  GetLoadFactor()  //
+      -> double
+  {
+    const std::shared_lock guard{mtx_};
+    return static_cast<double>(used_) / static_cast<double>(slots_.size());
+  }
+
+  /**
+   * @brief Grow the table so that it stores the given records without resizing.
+   *
+   * @param rec_num The expected number of records.
+   */
+  void
+  Reserve(  //
+      const size_t rec_num)
+  {
+    const std::lock_guard guard{mtx_};
+    const auto cap = std::bit_ceil(static_cast<size_t>(rec_num / kMaxLoadFactor) + 1);
+    if (cap > slots_.size()) {
+      Rehash(cap);
+    }
+  }
+
+  /**
+   * @param handler A callback for notifying resizes.
+   */
+  void
+  SetSMOHandler(  //
+      SMOHandler handler)
+  {
+    const std::lock_guard guard{mtx_};
+    smo_handler_ = std::move(handler);
+  }
+
+  /*##########################################################################*
+   * Public read APIs
+   *##########################################################################*/
+
+  auto
+  Read(  //
+      const Key& key,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    const std::shared_lock guard{mtx_};
+    const auto pos = Find(key);
+    if (!pos) return std::nullopt;
+    return slots_[*pos].payload;
+  }
+
+  /*##########################################################################*
+   * Public write APIs
+   *##########################################################################*/
+
+  void
+  Write(  //
+      const Key& key,
+      const Payload& payload,
+      const size_t key_len = sizeof(Key),
+      const MergeFn merge = nullptr)
+  {
+    Upsert(key, payload, key_len, merge);
+  }
+
+  auto
+  Upsert(  //
+      const Key& key,
+      const Payload& payload,
+      [[maybe_unused]] const size_t key_len = sizeof(Key),
+      const MergeFn merge = nullptr)  //
+      -> std::optional<Payload>
+  {
+    const std::lock_guard guard{mtx_};
+    auto& slot = slots_[FindOrReserve(key)];
+    if (slot.state != kOccupied) {
+      slot = Slot{key, payload, kOccupied};
+      ++size_;
+      return std::nullopt;
+    }
+
+    const auto old = slot.payload;
+    slot.payload = (merge == nullptr) ? payload : merge(old, payload);
+    return old;
+  }
+
+  auto
+  Insert(  //
+      const Key& key,
+      const Payload& payload,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    const std::lock_guard guard{mtx_};
+    auto& slot = slots_[FindOrReserve(key)];
+    if (slot.state == kOccupied) return slot.payload;
+
+    slot = Slot{key, payload, kOccupied};
+    ++size_;
+    return std::nullopt;
+  }
+
+  auto
+  Update(  //
+      const Key& key,
+      const Payload& payload,
+      [[maybe_unused]] const size_t key_len = sizeof(Key),
+      const MergeFn merge = nullptr,
+      [[maybe_unused]] const size_t pay_len = sizeof(Payload))  //
+      -> std::optional<Payload>
+  {
+    const std::lock_guard guard{mtx_};
+    const auto pos = Find(key);
+    if (!pos) return std::nullopt;
+
+    auto& cur = slots_[*pos].payload;
+    const auto old = cur;
+    cur = (merge == nullptr) ? payload : merge(old, payload);
+    return old;
+  }
+
+  /**
+   * @param key A target key.
+   * @param expected An expected payload of the key.
+   * @param desired A payload written only if the current one is expected.
+   * @param key_len The length of the key.
+   * @return The payload before this operation if the key exists.
+   */
+  auto
+  CompareAndSwap(  //
+      const Key& key,
+      const Payload& expected,
+      const Payload& desired,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    const std::lock_guard guard{mtx_};
+    const auto pos = Find(key);
+    if (!pos) return std::nullopt;
+
+    auto& cur = slots_[*pos].payload;
+    const auto old = cur;
+    if (old == expected) {
+      cur = desired;
+    }
+    return old;
+  }
+
+  auto
+  Delete(  //
+      const Key& key,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    const std::lock_guard guard{mtx_};
+    const auto pos = Find(key);
+    if (!pos) return std::nullopt;
+
+    auto& slot = slots_[*pos];
+    slot.state = kDeleted;
+    --size_;
+    return slot.payload;
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal utilities
+   *##########################################################################*/
+
+  [[nodiscard]] auto
+  Find(  //
+      const Key& key) const  //
+      -> std::optional<size_t>
+  {
+    const auto mask = slots_.size() - 1;
+    for (auto pos = HashKey(key) & mask;; pos = (pos + 1) & mask) {
+      const auto& slot = slots_[pos];
+      if (slot.state == kEmpty) return std::nullopt;
+      if (slot.state == kOccupied && Equal<Comp>(slot.key, key)) return pos;
+    }
+  }
+
+  /**
+   * @param key A target key.
+   * @return The position of the given key if it exists. Otherwise, the
+   * position of a free slot for inserting the key.
+   */
+  auto
+  FindOrReserve(  //
+      const Key& key)  //
+      -> size_t
+  {
+    if (static_cast<double>(used_ + 1) > kMaxLoadFactor * static_cast<double>(slots_.size())) {
+      // grow the table only if live records occupy it
+      const auto grow = size_ + 1 > kMaxLoadFactor * static_cast<double>(slots_.size()) / 2;
+      Rehash(grow ? slots_.size() * 2 : slots_.size());
+    }
+
+    const auto mask = slots_.size() - 1;
+    std::optional<size_t> tombstone{};
+    for (auto pos = HashKey(key) & mask;; pos = (pos + 1) & mask) {
+      const auto& slot = slots_[pos];
+      if (slot.state == kEmpty) {
+        if (tombstone) return *tombstone;
+        ++used_;
+        return pos;
+      }
+      if (slot.state == kDeleted) {
+        if (!tombstone) {
+          tombstone = pos;
+        }
+      } else if (Equal<Comp>(slot.key, key)) {
+        return pos;
+      }
+    }
+  }
+
+  void
+  Rehash(  //
+      const size_t cap)
+  {
+    if (smo_handler_ && cap != slots_.size()) {
+      smo_handler_(kResize);
+    }
+
+    std::vector<Slot> old(cap);
+    old.swap(slots_);
+    used_ = size_;
+
+    const auto mask = slots_.size() - 1;
+    for (auto&& slot : old) {
+      if (slot.state != kOccupied) continue;
+      auto pos = HashKey(slot.key) & mask;
+      while (slots_[pos].state != kEmpty) {
+        pos = (pos + 1) & mask;
+      }
+      slots_[pos] = std::move(slot);
+    }
+  }
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief A mutex for protecting the hash table.
+  std::shared_mutex mtx_{};
+
+  /// @brief Slots of the hash table.
+  std::vector<Slot> slots_ = std::vector<Slot>(kInitCapacity);
+
+  /// @brief The number of live records.
+  size_t size_{};
+
+  /// @brief The number of non-empty slots (i.e., records and tombstones).
+  size_t used_{};
+
+  /// @brief A callback for notifying resizes.
+  SMOHandler smo_handler_{};
+};
+
+/**
+ * @brief A baseline secondary index storing multiple payloads per key.
+ *
+ * Records are kept in `std::set` ordered by keys and then payloads, i.e., each
+ * payload acts as a uniquifier of duplicate keys. The entire set is protected
+ * by `std::shared_mutex`, and an iterator holds a shared lock until it is
+ * destructed.
+ *
+ * @tparam Key A class of stored keys.
+ * @tparam Payload A class of stored payloads.
+ * @tparam Comp A comparator for keys.
+ */
+template <class Key, class Payload, class Comp>
+class MultiMapIndex
+{
+  /*##########################################################################*
+   * Type aliases
+   *##########################################################################*/
+
+  using Record = std::pair<Key, Payload>;
+  using ScanKey = std::optional<std::tuple<Key, size_t, bool>>;
+
+  /*##########################################################################*
+   * Internal classes
+   *##########################################################################*/
+
+  /// @brief A comparator for records, which also compares records with keys.
+  struct RecordComp {
+    using is_transparent = void;
+
+    auto
+    operator()(  //
+        const Record& lhs,
+        const Record& rhs) const  //
+        -> bool
+    {
+      if (Comp{}(lhs.first, rhs.first)) return true;
+      if (Comp{}(rhs.first, lhs.first)) return false;
+      return lhs.second < rhs.second;
+    }
+
+    auto
+    operator()(  //
+        const Record& lhs,
+        const Key& rhs) const  //
+        -> bool
+    {
+      return Comp{}(lhs.first, rhs);
+    }
+
+    auto
+    operator()(  //
+        const Key& lhs,
+        const Record& rhs) const  //
+        -> bool
+    {
+      return Comp{}(lhs, rhs.first);
+    }
+  };
+
+  using Set = std::set<Record, RecordComp>;
+  using SetIter = typename Set::const_iterator;
+
+ public:
+  /*##########################################################################*
+   * Public constants
+   *##########################################################################*/
+
+  /// @brief `Insert` accepts duplicate keys with different payloads.
+  static constexpr bool kAllowDuplicates = true;
+
+  /*##########################################################################*
+   * Public classes
+   *##########################################################################*/
+
+  /**
+   * @brief An iterator for reading records in ascending order.
+   *
+   */
+  class RecordIterator
+  {
+   public:
+    RecordIterator() = default;
+
+    RecordIterator(  //
+        std::shared_lock<std::shared_mutex>&& guard,
+        const SetIter begin,
+        const SetIter end)
+        : guard_{std::move(guard)}, cur_{begin}, end_{end}
+    {
+    }
+
+    RecordIterator(const RecordIterator&) = delete;
+    RecordIterator(RecordIterator&&) noexcept = default;
+
+    auto operator=(const RecordIterator&) -> RecordIterator& = delete;
+    auto operator=(RecordIterator&&) noexcept -> RecordIterator& = default;
+
+    ~RecordIterator() = default;
+
+    explicit
+    operator bool() const noexcept
+    {
+      return guard_ && cur_ != end_;
+    }
+
+    auto
+    operator*() const  //
+        -> std::pair<Key, Payload>
+    {
+      return *cur_;
+    }
+
+    void
+    operator++() noexcept
+    {
+      ++cur_;
+    }
+
+    constexpr void
+    PrepareVerifier() const noexcept
+    {
+    }
+
+    [[nodiscard]] constexpr auto
+    VerifySnapshot() const noexcept  //
+        -> bool
+    {
+      return true;  // the set is locked while scanning
+    }
+
+    [[nodiscard]] constexpr auto
+    VerifyNoPhantom() const noexcept  //
+        -> bool
+    {
+      return true;  // the set is locked while scanning
+    }
+
+   private:
+    /// @brief A shared lock of the set.
+    std::shared_lock<std::shared_mutex> guard_{};
+
+    /// @brief The current position.
+    SetIter cur_{};
+
+    /// @brief The end position.
+    SetIter end_{};
+  };
+
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  MultiMapIndex() = default;
+
+  MultiMapIndex(const MultiMapIndex&) = delete;
+  MultiMapIndex(MultiMapIndex&&) = delete;
+
+  auto operator=(const MultiMapIndex&) -> MultiMapIndex& = delete;
+  auto operator=(MultiMapIndex&&) -> MultiMapIndex& = delete;
+
+  ~MultiMapIndex() = default;
+
+  /*##########################################################################*
+   * Public read APIs
+   *##########################################################################*/
+
+  /**
+   * @param key A target key.
+   * @return The smallest payload of the given key if it exists.
+   */
+  auto
+  Read(  //
+      const Key& key,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    const std::shared_lock guard{mtx_};
+    const auto it = records_.lower_bound(key);
+    if (it == records_.end() || Comp{}(key, it->first)) return std::nullopt;
+    return it->second;
+  }
+
+  auto
+  Scan(  //
+      const ScanKey& begin_key = std::nullopt,
+      const ScanKey& end_key = std::nullopt)  //
+      -> RecordIterator
+  {
+    std::shared_lock guard{mtx_};
+    if (IsEmptyRange<Key, Comp>(begin_key, end_key)) {
+      return RecordIterator{std::move(guard), records_.cend(), records_.cend()};
+    }
+
+    auto begin = records_.cbegin();
+    if (begin_key) {
+      const auto& [key, _, closed] = *begin_key;
+      begin = closed ? records_.lower_bound(key) : records_.upper_bound(key);
+    }
+    auto end = records_.cend();
+    if (end_key) {
+      const auto& [key, _, closed] = *end_key;
+      end = closed ? records_.upper_bound(key) : records_.lower_bound(key);
+    }
+    return RecordIterator{std::move(guard), begin, end};
+  }
+
+  /*##########################################################################*
+   * Public write APIs
+   *##########################################################################*/
+
+  /**
+   * @param key A target key.
+   * @param payload A payload to be added to the key.
+   * @return The given payload if the same pair already exists.
+   */
+  auto
+  Insert(  //
+      const Key& key,
+      const Payload& payload,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    const std::lock_guard guard{mtx_};
+    if (!records_.emplace(key, payload).second) return payload;
+    return std::nullopt;
+  }
+
+  /**
+   * @param key A target key.
+   * @return The smallest payload of deleted records if the key exists.
+   */
+  auto
+  Delete(  //
+      const Key& key,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    const std::lock_guard guard{mtx_};
+    const auto [begin, end] = records_.equal_range(key);
+    if (begin == end) return std::nullopt;
+
+    const auto old = begin->second;
+    records_.erase(begin, end);
+    return old;
+  }
+
+  /**
+   * @param key A target key.
+   * @param payload A target payload of the key.
+   * @param key_len The length of the key.
+   * @return The deleted payload if the pair exists.
+   */
+  auto
+  Delete(  //
+      const Key& key,
+      const Payload& payload,
+      [[maybe_unused]] const size_t key_len)  //
+      -> std::optional<Payload>
+  {
+    const std::lock_guard guard{mtx_};
+    if (records_.erase(Record{key, payload}) == 0) return std::nullopt;
+    return payload;
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief A mutex for protecting records.
+  std::shared_mutex mtx_{};
+
+  /// @brief Records ordered by keys and payloads.
+  Set records_{};
+};
+
+/**
+ * @brief A baseline multi-version index using hash-partitioned `std::map`s.
+ *
+ * Each key has a chain of versions stamped by a global clock, and deleted keys
+ * leave tombstones. A write prunes the versions of its key that no pinned
+ * snapshot can read, and so the chains of frequently updated keys grow while
+ * old snapshots are pinned. `Consolidate()` prunes all the chains.
+ *
+ * @tparam Key A class of stored keys.
+ * @tparam Payload A class of stored payloads.
+ * @tparam Comp A comparator for keys.
+ */
+template <class Key, class Payload, class Comp>
+class VersionedMapIndex
+{
+  /*##########################################################################*
+   * Type aliases
+   *##########################################################################*/
+
+  using Version = std::pair<uint64_t, std::optional<Payload>>;
+  using Chain = std::vector<Version>;
+  using Map = std::map<Key, Chain, Comp>;
+  using ScanKey = std::optional<std::tuple<Key, size_t, bool>>;
+  using MergeFn = Payload (*)(const Payload&, const Payload&);
+
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  static constexpr size_t kShardNum = 16;
+
+  static constexpr uint64_t kNoSnapshot = ~0UL;
+
+  /// @brief The color and links of each node in red-black trees.
+  static constexpr size_t kMapNodeOverhead = 4 * sizeof(void*);
+
+  /*##########################################################################*
+   * Internal classes
+   *##########################################################################*/
+
+  /// @brief A shard padded for avoiding false sharing.
+  struct alignas(kCacheLineSize) Shard {
+    std::shared_mutex mtx{};
+    Map map{};
+  };
+
+ public:
+  /*##########################################################################*
+   * Public classes
+   *##########################################################################*/
+
+  /**
+   * @brief An iterator for records copied from a snapshot.
+   *
+   */
+  class RecordIterator
+  {
+   public:
+    RecordIterator() = default;
+
+    explicit RecordIterator(  //
+        std::vector<std::pair<Key, Payload>>&& records)
+        : records_{std::move(records)}
+    {
+    }
+
+    RecordIterator(const RecordIterator&) = delete;
+    RecordIterator(RecordIterator&&) noexcept = default;
+
+    auto operator=(const RecordIterator&) -> RecordIterator& = delete;
+    auto operator=(RecordIterator&&) noexcept -> RecordIterator& = default;
+
+    ~RecordIterator() = default;
+
+    explicit
+    operator bool() const noexcept
+    {
+      return pos_ < records_.size();
+    }
+
+    auto
+    operator*() const  //
+        -> std::pair<Key, Payload>
+    {
+      return records_[pos_];
+    }
+
+    void
+    operator++() noexcept
+    {
+      ++pos_;
+    }
+
+    constexpr void
+    PrepareVerifier() const noexcept
+    {
+    }
+
+    [[nodiscard]] constexpr auto
+    VerifySnapshot() const noexcept  //
+        -> bool
+    {
+      return true;  // records are read at a single timestamp
+    }
+
+    [[nodiscard]] constexpr auto
+    VerifyNoPhantom() const noexcept  //
+        -> bool
+    {
+      return true;  // records are read at a single timestamp
+    }
+
+   private:
+    /// @brief Visible records in ascending order.
+    std::vector<std::pair<Key, Payload>> records_{};
+
+    /// @brief The position of the current record.
+    size_t pos_{};
+  };
+
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  VersionedMapIndex() = default;
+
+  VersionedMapIndex(const VersionedMapIndex&) = delete;
+  VersionedMapIndex(VersionedMapIndex&&) = delete;
+
+  auto operator=(const VersionedMapIndex&) -> VersionedMapIndex& = delete;
+  auto operator=(VersionedMapIndex&&) -> VersionedMapIndex& = delete;
+
+  ~VersionedMapIndex() = default;
+
+  /*##########################################################################*
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Pin a snapshot of the current state.
+   *
+   * @return A token for reading the snapshot.
+   */
+  auto
+  GetSnapshot()  //
+      -> uint64_t
+  {
+    const std::lock_guard guard{snap_mtx_};
+
+    // publish a lower bound before reading the clock again so that concurrent
+    // writers never prune the versions visible to the new snapshot
+    const auto lower = clock_.load();
+    min_snapshot_.store(snapshots_.empty() ? lower : std::min(lower, *snapshots_.begin()));
+    const auto ts = clock_.load();
+    snapshots_.insert(ts);
+    min_snapshot_.store(*snapshots_.begin());
+    return ts;
+  }
+
+  /**
+   * @param snapshot A token pinned by `GetSnapshot()`.
+   */
+  void
+  ReleaseSnapshot(  //
+      const uint64_t snapshot)
+  {
+    const std::lock_guard guard{snap_mtx_};
+    const auto it = snapshots_.find(snapshot);
+    if (it == snapshots_.end()) return;  // unknown or already released
+    snapshots_.erase(it);
+    min_snapshot_.store(snapshots_.empty() ? kNoSnapshot : *snapshots_.begin());
+  }
+
+  /**
+   * @return The total number of versions including tombstones.
+   */
+  [[nodiscard]] auto
+  GetVersionCount() const  //
+      -> size_t
+  {
+    return version_num_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Estimate the memory usage from map nodes and version chains.
+   *
+   * The estimation excludes allocator overheads, but it is not affected by
+   * concurrent allocations outside this index, unlike heap statistics.
+   *
+   * @return The estimated memory usage in bytes.
+   */
+  auto
+  GetMemoryUsage()  //
+      -> size_t
+  {
+    size_t usage = sizeof(*this);
+    for (auto&& shard : shards_) {
+      const std::shared_lock guard{shard.mtx};
+      usage += shard.map.size() * (kMapNodeOverhead + sizeof(typename Map::value_type));
+      for (const auto& [key, chain] : shard.map) {
+        usage += chain.capacity() * sizeof(Version);
+      }
+    }
+    {
+      const std::lock_guard guard{snap_mtx_};
+      usage += snapshots_.size() * (kMapNodeOverhead + sizeof(uint64_t));
+    }
+    return usage;
+  }
+
+  /**
+   * @brief Prune the versions that no pinned snapshot can read.
+   *
+   */
+  void
+  Consolidate()
+  {
+    for (auto&& shard : shards_) {
+      const std::lock_guard guard{shard.mtx};
+      const auto bound = GetPruneBound(clock_.load());
+      for (auto it = shard.map.begin(); it != shard.map.end();) {
+        Prune(it->second, bound);
+        it = it->second.empty() ? shard.map.erase(it) : std::next(it);
+      }
+    }
+  }
+
+  /*##########################################################################*
+   * Public read APIs
+   *##########################################################################*/
+
+  auto
+  Read(  //
+      const Key& key,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    return ReadAt(key, kNoSnapshot);
+  }
+
+  /**
+   * @param key A target key.
+   * @param snapshot A token pinned by `GetSnapshot()`.
+   * @param key_len The length of the key.
+   * @return The payload visible to the snapshot if it exists.
+   */
+  auto
+  ReadAt(  //
+      const Key& key,
+      const uint64_t snapshot,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    auto& shard = GetShard(key);
+    const std::shared_lock guard{shard.mtx};
+    const auto it = shard.map.find(key);
+    if (it == shard.map.end()) return std::nullopt;
+    return GetVisible(it->second, snapshot);
+  }
+
+  auto
+  Scan(  //
+      const ScanKey& begin_key = std::nullopt,
+      const ScanKey& end_key = std::nullopt)  //
+      -> RecordIterator
+  {
+    const auto snapshot = GetSnapshot();
+    auto iter = ScanAt(snapshot, begin_key, end_key);
+    ReleaseSnapshot(snapshot);
+    return iter;
+  }
+
+  /**
+   * @param snapshot A token pinned by `GetSnapshot()`.
+   * @param begin_key An optional begin key.
+   * @param end_key An optional end key.
+   * @return An iterator for the records visible to the snapshot.
+   */
+  auto
+  ScanAt(  //
+      const uint64_t snapshot,
+      const ScanKey& begin_key = std::nullopt,
+      const ScanKey& end_key = std::nullopt)  //
+      -> RecordIterator
+  {
+    std::vector<std::pair<Key, Payload>> records{};
+    if (IsEmptyRange<Key, Comp>(begin_key, end_key)) return RecordIterator{std::move(records)};
+
+    for (auto&& shard : shards_) {
+      const std::shared_lock guard{shard.mtx};
+      auto lo = shard.map.cbegin();
+      if (begin_key) {
+        const auto& [key, _, closed] = *begin_key;
+        lo = closed ? shard.map.lower_bound(key) : shard.map.upper_bound(key);
+      }
+      auto hi = shard.map.cend();
+      if (end_key) {
+        const auto& [key, _, closed] = *end_key;
+        hi = closed ? shard.map.upper_bound(key) : shard.map.lower_bound(key);
+      }
+      for (; lo != hi; ++lo) {
+        const auto& payload = GetVisible(lo->second, snapshot);
+        if (payload) {
+          records.emplace_back(lo->first, *payload);
+        }
+      }
+    }
+    std::sort(records.begin(), records.end(), [](const auto& lhs, const auto& rhs) {
+      return Comp{}(lhs.first, rhs.first);
+    });
+    return RecordIterator{std::move(records)};
+  }
+
+  /*##########################################################################*
+   * Public write APIs
+   *##########################################################################*/
+
+  void
+  Write(  //
+      const Key& key,
+      const Payload& payload,
+      [[maybe_unused]] const size_t key_len = sizeof(Key),
+      const MergeFn merge = nullptr)
+  {
+    Modify(key, [&](const std::optional<Payload>& old) -> std::optional<Version> {
+      return Version{0, (!old || merge == nullptr) ? payload : merge(*old, payload)};
+    });
+  }
+
+  auto
+  Upsert(  //
+      const Key& key,
+      const Payload& payload,
+      [[maybe_unused]] const size_t key_len = sizeof(Key),
+      const MergeFn merge = nullptr)  //
+      -> std::optional<Payload>
+  {
+    return Modify(key, [&](const std::optional<Payload>& old) -> std::optional<Version> {
+      return Version{0, (!old || merge == nullptr) ? payload : merge(*old, payload)};
+    });
+  }
+
+  auto
+  Insert(  //
+      const Key& key,
+      const Payload& payload,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    return Modify(key, [&](const std::optional<Payload>& old) -> std::optional<Version> {
+      if (old) return std::nullopt;
+      return Version{0, payload};
+    });
+  }
+
+  auto
+  Update(  //
+      const Key& key,
+      const Payload& payload,
+      [[maybe_unused]] const size_t key_len = sizeof(Key),
+      const MergeFn merge = nullptr,
+      [[maybe_unused]] const size_t pay_len = sizeof(Payload))  //
+      -> std::optional<Payload>
+  {
+    return Modify(key, [&](const std::optional<Payload>& old) -> std::optional<Version> {
+      if (!old) return std::nullopt;
+      return Version{0, (merge == nullptr) ? payload : merge(*old, payload)};
+    });
+  }
+
+  /**
+   * @param key A target key.
+   * @param expected An expected payload of the key.
+   * @param desired A payload written only if the current one is expected.
+   * @param key_len The length of the key.
+   * @return The payload before this operation if the key exists.
+   */
+  auto
+  CompareAndSwap(  //
+      const Key& key,
+      const Payload& expected,
+      const Payload& desired,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    return Modify(key, [&](const std::optional<Payload>& old) -> std::optional<Version> {
+      if (!old || *old != expected) return std::nullopt;
+      return Version{0, desired};
+    });
+  }
+
+  auto
+  Delete(  //
+      const Key& key,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    return Modify(key, [&](const std::optional<Payload>& old) -> std::optional<Version> {
+      if (!old) return std::nullopt;
+      return Version{0, std::nullopt};  // a tombstone
+    });
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal utilities
+   *##########################################################################*/
+
+  auto
+  GetShard(  //
+      const Key& key)  //
+      -> Shard&
+  {
+    return shards_[HashKey(key) % kShardNum];
+  }
+
+  /**
+   * @param chain A version chain in ascending order of timestamps.
+   * @param snapshot A snapshot timestamp.
+   * @return The payload visible to the snapshot if it exists.
+   */
+  static auto
+  GetVisible(  //
+      const Chain& chain,
+      const uint64_t snapshot)  //
+      -> std::optional<Payload>
+  {
+    for (auto it = chain.crbegin(); it != chain.crend(); ++it) {
+      if (it->first <= snapshot) return it->second;
+    }
+    return std::nullopt;
+  }
+
+  /**
+   * @param now A timestamp read before the oldest snapshot.
+   * @return The newest timestamp that every pinned snapshot can read.
+   */
+  [[nodiscard]] auto
+  GetPruneBound(  //
+      const uint64_t now) const  //
+      -> uint64_t
+  {
+    return std::min(now, min_snapshot_.load());
+  }
+
+  /**
+   * @brief Remove the versions hidden by a newer one from every snapshot.
+   *
+   * @param chain A version chain in ascending order of timestamps.
+   * @param bound The newest timestamp that every pinned snapshot can read.
+   */
+  void
+  Prune(  //
+      Chain& chain,
+      const uint64_t bound)
+  {
+    size_t pos = 0;
+    while (pos + 1 < chain.size() && chain[pos + 1].first <= bound) {
+      ++pos;
+    }
+    if (!chain[pos].second && chain[pos].first <= bound) {
+      ++pos;  // a visible tombstone is equivalent to no version
+    }
+    if (pos == 0) return;
+
+    chain.erase(chain.begin(), chain.begin() + pos);
+    version_num_.fetch_sub(pos, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Append a new version of a key if needed.
+   *
+   * @param key A target key.
+   * @param create A function for creating a new version from the latest
+   * payload, which returns `std::nullopt` if the key should not be modified.
+   * @return The latest payload before modification if it exists.
+   */
+  template <class Func>
+  auto
+  Modify(  //
+      const Key& key,
+      Func&& create)  //
+      -> std::optional<Payload>
+  {
+    auto& shard = GetShard(key);
+    const std::lock_guard guard{shard.mtx};
+    auto [it, inserted] = shard.map.try_emplace(key);
+    auto& chain = it->second;
+    const auto old = chain.empty() ? std::nullopt : chain.back().second;
+
+    if (auto&& version = create(old); version) {
+      const auto ts = clock_.fetch_add(1) + 1;
+      version->first = ts;
+      chain.emplace_back(std::move(*version));
+      version_num_.fetch_add(1, std::memory_order_relaxed);
+      Prune(chain, GetPruneBound(ts));
+    }
+    if (chain.empty()) {
+      shard.map.erase(it);
+    }
+    return old;
+  }
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief Hash-partitioned ordered maps of version chains.
+  std::array<Shard, kShardNum> shards_{};
+
+  /// @brief A global clock for stamping versions.
+  std::atomic_uint64_t clock_{0};
+
+  /// @brief The oldest pinned snapshot.
+  std::atomic_uint64_t min_snapshot_{kNoSnapshot};
+
+  /// @brief The total number of versions.
+  std::atomic_size_t version_num_{0};
+
+  /// @brief A mutex for protecting pinned snapshots.
+  std::mutex snap_mtx_{};
+
+  /// @brief Pinned snapshots.
+  std::multiset<uint64_t> snapshots_{};
+};
+
+}  // namespace dbgroup::index::test
+
+#endif  // DBGROUP_INDEX_FIXTURES_BASELINE_INDEXES_HPP
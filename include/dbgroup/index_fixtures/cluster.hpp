@@ -0,0 +1,670 @@
+/*
+ * Copyright 2026 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_INDEX_FIXTURES_CLUSTER_HPP
+#define DBGROUP_INDEX_FIXTURES_CLUSTER_HPP
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// system libraries
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// local sources
+#include "common.hpp"
+#include "metrics.hpp"
+
+namespace dbgroup::index::test
+{
+/*############################################################################*
+ * Global constants
+ *############################################################################*/
+
+/// @brief An environment variable for overwriting the node ID at runtime.
+constexpr char kNodeIDEnv[] = "DBGROUP_TEST_NODE_ID";
+
+/// @brief An environment variable for sharing the ID of a cluster among nodes.
+constexpr char kClusterIDEnv[] = "DBGROUP_TEST_CLUSTER_ID";
+
+/// @brief The delay of a synchronized start after all the nodes reach a barrier.
+constexpr uint64_t kSyncStartDelay = 1000000;  // 1 ms
+
+/// @brief The suffix of metrics for the number of round trips.
+constexpr char kRoundTripsSuffix[] = ".round_trips";
+
+/// @brief The suffix of metrics for the number of operations with round trips.
+constexpr char kOpsSuffix[] = ".ops";
+
+/*############################################################################*
+ * Global utility classes
+ *############################################################################*/
+
+/**
+ * @brief Node-local information of a (possibly emulated) cluster.
+ *
+ * A node ID is assigned by `LocalCluster` at runtime. If a process is not
+ * launched by `LocalCluster`, the ID is read from `DBGROUP_TEST_NODE_ID` or
+ * falls back to `kNodeID`.
+ */
+class NodeContext
+{
+ public:
+  /*##########################################################################*
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @return The ID of this node.
+   */
+  static auto
+  GetNodeID()  //
+      -> size_t
+  {
+    return node_id_;
+  }
+
+  /**
+   * @return The ID of the cluster for naming resources shared among nodes.
+   */
+  static auto
+  GetClusterID()  //
+      -> std::string
+  {
+    const auto* env = std::getenv(kClusterIDEnv);  // NOLINT
+    return (env == nullptr) ? "0" : env;
+  }
+
+  /**
+   * @retval true if this process is connected to a coordinator.
+   * @retval false otherwise.
+   */
+  static auto
+  IsConnected()  //
+      -> bool
+  {
+    return fd_ >= 0;
+  }
+
+  /**
+   * @brief Report a metric to the coordinator for aggregation.
+   *
+   * This function does nothing if this process is not a node of a cluster.
+   *
+   * @param name The name of a metric.
+   * @param value The value of the metric.
+   */
+  static void
+  ReportMetric(  //
+      const std::string& name,
+      const double value)
+  {
+    if (fd_ < 0) return;
+
+    std::ostringstream line{};
+    line << std::setprecision(std::numeric_limits<double>::max_digits10)  //
+         << "metric " << name << ' ' << value << '\n';
+    SendLine(line.str());
+  }
+
+  /**
+   * @brief Wait for all the nodes to reach this barrier and start together.
+   *
+   * The coordinator releases the nodes with a common start timestamp, and each
+   * node waits until the timestamp. Barriers are matched by their order, so all
+   * the nodes must call this function the same number of times. If this process
+   * is not a node of a cluster, this function returns immediately.
+   *
+   * @return The synchronized start timestamp.
+   * @throws std::runtime_error if another node disconnected without leaving.
+   */
+  static auto
+  Barrier()  //
+      -> uint64_t
+  {
+    if (fd_ < 0) return GetTimestamp();
+
+    SendLine("barrier\n");
+    std::string line{};
+    for (char c{}; c != '\n';) {
+      if (::read(fd_, &c, 1) != 1) throw std::runtime_error{"Failed to wait for a barrier."};
+      line.push_back(c);
+    }
+
+    std::istringstream in{line};
+    std::string type{};
+    uint64_t start{};
+    in >> type >> start;
+    if (type == "abort") throw std::runtime_error{"A node disconnected without leaving."};
+    while (GetTimestamp() < start) {
+      std::this_thread::yield();
+    }
+    return start;
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal utilities
+   *##########################################################################*/
+
+  friend class LocalCluster;
+
+  static auto
+  LoadNodeID()  //
+      -> size_t
+  {
+    const auto* env = std::getenv(kNodeIDEnv);  // NOLINT
+    return (env == nullptr) ? kNodeID : std::stoul(env);
+  }
+
+  static void
+  SendLine(  //
+      const std::string& line)
+  {
+    for (size_t sent = 0; sent < line.size();) {
+      const auto n = ::write(fd_, line.data() + sent, line.size() - sent);
+      if (n <= 0) throw std::runtime_error{"Failed to send a message to the coordinator."};
+      sent += static_cast<size_t>(n);
+    }
+  }
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The ID of this node.
+  static inline size_t node_id_ = LoadNodeID();
+
+  /// @brief A socket connected to the coordinator.
+  static inline int fd_ = -1;
+};
+
+/**
+ * @brief A launcher for emulating a cluster with processes on one host.
+ *
+ * `Launch` forks one process per node and assigns a node ID to each of them.
+ * The launcher process serves as a coordinator, which receives metrics from
+ * nodes over a Unix domain socket and aggregates them. The coordinator also
+ * implements a cross-node barrier (see `NodeContext::Barrier`).
+ *
+ * Each node sends a `leave` message when its function returns, and nodes that
+ * have left do not block barriers. If a node disconnects without leaving (e.g.,
+ * it crashed), the coordinator aborts the current and later barriers, marks the
+ * aggregated results invalid, and `Launch` fails. The same applies to a node
+ * that exits without registering itself (e.g., it failed to connect).
+ *
+ * A test binary can run all the tests on every node as follows:
+ *
+ *     int main(int argc, char** argv) {
+ *       ::testing::InitGoogleTest(&argc, argv);
+ *       LocalCluster cluster{};
+ *       return cluster.Launch([](size_t) { return RUN_ALL_TESTS(); });
+ *     }
+ */
+class LocalCluster
+{
+ public:
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  explicit LocalCluster(  //
+      const size_t node_num = kNodeNum)
+      : node_num_{node_num}
+  {
+  }
+
+  /*##########################################################################*
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Run the given function on every node.
+   *
+   * If this process is already a node or the cluster consists of one node, the
+   * function is executed in this process without forking.
+   *
+   * @param node_main A function executed by each node with its node ID.
+   * @retval 0 if all the nodes returned zero and left the cluster.
+   * @retval 1 otherwise.
+   */
+  auto
+  Launch(  //
+      const std::function<int(size_t)>& node_main)  //
+      -> int
+  {
+    results_.clear();
+    is_valid_ = true;
+    if (node_num_ <= 1 || NodeContext::IsConnected() || std::getenv(kNodeIDEnv) != nullptr) {
+      return node_main(NodeContext::GetNodeID());
+    }
+
+    const auto listen_fd = Listen();
+    std::cout << std::flush;
+    std::fflush(nullptr);
+
+    nodes_.assign(node_num_, Node{});
+    for (size_t id = 0; id < node_num_; ++id) {
+      const auto pid = ::fork();
+      if (pid < 0) throw std::runtime_error{"Failed to fork a node process."};
+      if (pid == 0) {
+        ::close(listen_fd);
+        RunNode(id, node_main);  // never returns
+      }
+      nodes_[id].pid = pid;
+    }
+
+    Coordinate(listen_fd);
+    ::close(listen_fd);
+    ::unlink(sock_path_.c_str());
+
+    auto rc = is_valid_ ? 0 : 1;
+    for (auto&& node : nodes_) {
+      if (!node.status) {
+        int status{};
+        ::waitpid(node.pid, &status, 0);
+        node.status = status;
+      }
+      if (!WIFEXITED(*node.status) || WEXITSTATUS(*node.status) != 0) {
+        rc = 1;
+      }
+    }
+    return rc;
+  }
+
+  /**
+   * @retval true if all the nodes left the cluster after their execution.
+   * @retval false if any node disconnected early, i.e., the results are partial.
+   */
+  [[nodiscard]] auto
+  IsValid() const  //
+      -> bool
+  {
+    return is_valid_;
+  }
+
+  /**
+   * @return Reported metrics: the values of each node for each metric name.
+   */
+  [[nodiscard]] auto
+  GetResults() const  //
+      -> const std::map<std::string, std::vector<double>>&
+  {
+    return results_;
+  }
+
+  /**
+   * @param name The name of a metric.
+   * @return The sum of the metric over all the nodes.
+   */
+  [[nodiscard]] auto
+  GetTotal(  //
+      const std::string& name) const  //
+      -> double
+  {
+    double total = 0;
+    if (const auto it = results_.find(name); it != results_.end()) {
+      for (const auto val : it->second) {
+        total += val;
+      }
+    }
+    return total;
+  }
+
+  /**
+   * @param name The name of a metric.
+   * @return The number of round trips per operation over all the nodes.
+   */
+  [[nodiscard]] auto
+  GetRoundTripsPerOp(  //
+      const std::string& name) const  //
+      -> double
+  {
+    const auto ops = GetTotal(name + kOpsSuffix);
+    return (ops > 0) ? GetTotal(name + kRoundTripsSuffix) / ops : 0;
+  }
+
+  /**
+   * @brief Print the aggregated metrics.
+   *
+   * Round trips per operation are derived from the summed counts of round trips
+   * and operations, since averaging per-node ratios biases toward small nodes.
+   *
+   * @param out An output stream.
+   */
+  void
+  Report(  //
+      std::ostream& out = std::cout) const
+  {
+    const auto prec = out.precision(std::numeric_limits<double>::digits10);
+    if (!is_valid_) {
+      out << "  [dbgroup] INVALID: a node disconnected or exited before finishing its execution\n";
+    }
+    for (const auto& [name, vals] : results_) {
+      out << "  [dbgroup] " << name << ": " << GetTotal(name) << " (";
+      for (size_t i = 0; i < vals.size(); ++i) {
+        out << (i == 0 ? "" : ", ") << "node " << i << ": " << vals[i];
+      }
+      out << ")\n";
+    }
+    for (const auto& [name, vals] : results_) {
+      if (!name.ends_with(kRoundTripsSuffix)) continue;
+      const auto base = name.substr(0, name.size() - std::strlen(kRoundTripsSuffix));
+      if (!results_.contains(base + kOpsSuffix)) continue;
+      out << "  [dbgroup] " << base << ".round_trips_per_op: " << GetRoundTripsPerOp(base) << "\n";
+    }
+    out.precision(prec);
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal classes
+   *##########################################################################*/
+
+  /// @brief The state of a connection from a node.
+  struct Connection {
+    /// @brief Received bytes that do not form a line yet.
+    std::string buf{};
+
+    /// @brief The ID of the connected node.
+    size_t node_id{};
+
+    /// @brief A flag for nodes that have finished their execution.
+    bool has_left{false};
+
+    /// @brief A flag for connections that have registered their node IDs.
+    bool is_registered{false};
+  };
+
+  /// @brief The state of a forked node process.
+  struct Node {
+    /// @brief The ID of this process.
+    pid_t pid{};
+
+    /// @brief The exit status of this process if it has been reaped.
+    std::optional<int> status{};
+
+    /// @brief The time when this process was reaped.
+    uint64_t exited_at{};
+
+    /// @brief A flag for nodes that have registered their IDs.
+    bool is_registered{false};
+
+    /// @brief A flag for nodes that exited without registration.
+    bool is_dropped{false};
+  };
+
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The timeout [ms] for checking nodes while waiting for messages.
+  static constexpr int kPollTimeout = 100;
+
+  /// @brief The time [ns] for reading pending messages from an exited node.
+  static constexpr uint64_t kRegistrationGrace = 1000000000;  // 1 s
+
+  /*##########################################################################*
+   * Internal utilities
+   *##########################################################################*/
+
+  auto
+  Listen()  //
+      -> int
+  {
+    sock_path_ = "/tmp/dbgroup_cluster_" + std::to_string(::getpid()) + ".sock";
+    ::unlink(sock_path_.c_str());
+
+    const auto fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    auto addr = GetAddress();
+    if (fd < 0                                                                     //
+        || ::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0       // NOLINT
+        || ::listen(fd, static_cast<int>(node_num_)) != 0) {
+      throw std::runtime_error{"Failed to open a coordinator socket."};
+    }
+    return fd;
+  }
+
+  [[noreturn]] void
+  RunNode(  //
+      const size_t node_id,
+      const std::function<int(size_t)>& node_main)
+  {
+    auto rc = 1;
+    const auto fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    auto addr = GetAddress();
+    if (fd >= 0 && ::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0) {  // NOLINT
+      setenv(kNodeIDEnv, std::to_string(node_id).c_str(), 1);
+      setenv(kClusterIDEnv, std::to_string(::getppid()).c_str(), 1);
+      NodeContext::node_id_ = node_id;
+      NodeContext::fd_ = fd;
+      NodeContext::SendLine("node " + std::to_string(node_id) + '\n');
+      rc = node_main(node_id);
+      NodeContext::SendLine("leave\n");
+    }
+
+    std::cout << std::flush;
+    std::fflush(nullptr);
+    ::_exit(rc);  // skip the destructors of the launcher process
+  }
+
+  void
+  Coordinate(  //
+      const int listen_fd)
+  {
+    std::vector<pollfd> fds{{listen_fd, POLLIN, 0}};
+    std::vector<Connection> conns(1);
+    size_t accepted = 0;
+    size_t closed = 0;
+    while (closed < node_num_) {
+      if (::poll(fds.data(), fds.size(), kPollTimeout) < 0) continue;
+      closed += DropUnregisteredNodes();
+
+      for (size_t i = 0; i < fds.size(); ++i) {
+        if (fds[i].fd < 0 || (fds[i].revents & (POLLIN | POLLHUP | POLLERR)) == 0) continue;
+        if (i == 0) {
+          if (accepted < node_num_) {
+            fds.push_back({::accept(listen_fd, nullptr, nullptr), POLLIN, 0});
+            conns.emplace_back();
+            ++accepted;
+          }
+          continue;
+        }
+
+        auto& conn = conns[i];
+        char buf[4096];  // NOLINT
+        const auto n = ::read(fds[i].fd, buf, sizeof(buf));
+        if (n <= 0) {
+          ::close(fds[i].fd);
+          std::erase(waiting_, fds[i].fd);
+          fds[i].fd = -1;
+          if (conn.is_registered) {
+            ++closed;  // unregistered nodes are dropped after they exit
+          }
+          if (!conn.has_left) {
+            AbortBarrier();  // the survivors would measure a shrunken cluster
+          }
+          ReleaseBarrier(node_num_ - closed);  // finished nodes do not block others
+          continue;
+        }
+        conn.buf.append(buf, static_cast<size_t>(n));
+        for (auto pos = conn.buf.find('\n'); pos != std::string::npos; pos = conn.buf.find('\n')) {
+          HandleLine(conn.buf.substr(0, pos), fds[i].fd, conn);
+          conn.buf.erase(0, pos + 1);
+        }
+        ReleaseBarrier(node_num_ - closed);
+      }
+    }
+  }
+
+  /**
+   * @brief Reap exited nodes and drop the ones that exited without registration.
+   *
+   * A node that failed to connect exits without any message, so the coordinator
+   * would wait for it forever. Such a node is dropped after a grace period for
+   * reading its pending messages, and the results are invalidated.
+   *
+   * @return The number of newly dropped nodes.
+   */
+  auto
+  DropUnregisteredNodes()  //
+      -> size_t
+  {
+    size_t dropped = 0;
+    const auto now = GetTimestamp();
+    for (auto&& node : nodes_) {
+      if (!node.status) {
+        int status{};
+        if (::waitpid(node.pid, &status, WNOHANG) != node.pid) continue;
+        node.status = status;
+        node.exited_at = now;
+      }
+      if (node.is_registered || node.is_dropped || now - node.exited_at < kRegistrationGrace) {
+        continue;
+      }
+      node.is_dropped = true;
+      ++dropped;
+      AbortBarrier();
+    }
+    return dropped;
+  }
+
+  /**
+   * @brief Invalidate the results and fail all the current and later barriers.
+   *
+   */
+  void
+  AbortBarrier()
+  {
+    is_valid_ = false;
+    for (const auto fd : waiting_) {
+      SendAbort(fd);
+    }
+    waiting_.clear();
+  }
+
+  static void
+  SendAbort(  //
+      const int fd)
+  {
+    // the node may have exited already, so failures are ignored
+    constexpr char kLine[] = "abort\n";
+    [[maybe_unused]] const auto n = ::write(fd, kLine, sizeof(kLine) - 1);
+  }
+
+  void
+  ReleaseBarrier(  //
+      const size_t active_num)
+  {
+    if (waiting_.empty() || waiting_.size() < active_num) return;
+
+    const auto line = "release " + std::to_string(GetTimestamp() + kSyncStartDelay) + '\n';
+    for (const auto fd : waiting_) {
+      if (::write(fd, line.data(), line.size()) != static_cast<ssize_t>(line.size())) {
+        throw std::runtime_error{"Failed to release a barrier."};
+      }
+    }
+    waiting_.clear();
+  }
+
+  void
+  HandleLine(  //
+      const std::string& line,
+      const int fd,
+      Connection& conn)
+  {
+    std::istringstream in{line};
+    std::string type{};
+    in >> type;
+    if (type == "barrier") {
+      if (is_valid_) {
+        waiting_.emplace_back(fd);
+      } else {
+        SendAbort(fd);
+      }
+    } else if (type == "node") {
+      in >> conn.node_id;
+      auto& node = nodes_.at(conn.node_id);
+      if (!node.is_dropped) {
+        node.is_registered = true;
+        conn.is_registered = true;
+      }
+    } else if (type == "leave") {
+      conn.has_left = true;
+    } else if (type == "metric") {
+      std::string name{};
+      double value{};
+      in >> name >> value;
+      auto& vals = results_[name];
+      vals.resize(node_num_);
+      vals.at(conn.node_id) += value;
+    }
+  }
+
+  [[nodiscard]] auto
+  GetAddress() const  //
+      -> sockaddr_un
+  {
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, sock_path_.c_str(), sizeof(addr.sun_path) - 1);
+    return addr;
+  }
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The number of nodes.
+  size_t node_num_{kNodeNum};
+
+  /// @brief The path of a coordinator socket.
+  std::string sock_path_{};
+
+  /// @brief Forked node processes.
+  std::vector<Node> nodes_{};
+
+  /// @brief Reported metrics.
+  std::map<std::string, std::vector<double>> results_{};
+
+  /// @brief The sockets of nodes waiting for a barrier.
+  std::vector<int> waiting_{};
+
+  /// @brief A flag for results without early disconnects.
+  bool is_valid_{true};
+};
+
+}  // namespace dbgroup::index::test
+
+#endif  // DBGROUP_INDEX_FIXTURES_CLUSTER_HPP
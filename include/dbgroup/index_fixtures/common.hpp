@@ -18,6 +18,7 @@
 #define DBGROUP_INDEX_FIXTURES_COMMON_HPP
 
 // C++ standard libraries
+#include <algorithm>
 #include <bit>
 #include <concepts>
 #include <cstddef>
@@ -25,6 +26,11 @@
 #include <cstring>
 #include <functional>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <tuple>
 #include <type_traits>
 #include <vector>
 
@@ -55,6 +61,7 @@ enum AccessPattern {
   kSequential,
   kReverse,
   kRandom,
+  kClustered,
 };
 
 enum WriteOperation {
@@ -66,6 +73,38 @@ enum WriteOperation {
   kWithoutWrite,
 };
 
+enum KeyPartition {
+  kSharedKeys,
+  kRangePartition,
+  kHashPartition,
+  kSkewedPartition,
+};
+
+enum GapPattern {
+  kOddGaps,
+  kHashedGaps,
+};
+
+enum DuplicatePattern {
+  kUniformDuplicates,
+  kSkewedDuplicates,
+};
+
+enum HashKeyPattern {
+  kSequentialKeys,
+  kStridedKeys,
+  kHashCollisionKeys,
+};
+
+enum SMOType {
+  kLeafSplit,
+  kInternalSplit,
+  kMerge,
+  kRootGrowth,
+  kResize,
+  kSMOTypeNum,
+};
+
 constexpr size_t kExecNum = (DBGROUP_TEST_EXEC_NUM);
 
 constexpr size_t kRandomSeed = (DBGROUP_TEST_RANDOM_SEED);
@@ -78,10 +117,47 @@ constexpr size_t kNodeID = (DBGROUP_TEST_DISTRIBUTED_INDEX_NODE_ID);
 
 constexpr size_t kWorkerNum = kThreadNum * kNodeNum;
 
+#if defined(DBGROUP_TEST_KEY_PARTITION_RANGE)
+constexpr KeyPartition kKeyPartition = kRangePartition;
+#elif defined(DBGROUP_TEST_KEY_PARTITION_HASH)
+constexpr KeyPartition kKeyPartition = kHashPartition;
+#elif defined(DBGROUP_TEST_KEY_PARTITION_SKEWED)
+constexpr KeyPartition kKeyPartition = kSkewedPartition;
+#else
+constexpr KeyPartition kKeyPartition = kSharedKeys;
+#endif
+
+constexpr size_t kRemotePercent = (DBGROUP_TEST_REMOTE_ACCESS_PERCENT);
+
+/// @brief The number of workers that access each key.
+constexpr size_t kWritersPerKey = (kKeyPartition == kSharedKeys) ? kWorkerNum : kThreadNum;
+
+constexpr size_t kNetworkRTT = (DBGROUP_TEST_NETWORK_RTT_NS);
+
+constexpr size_t kNetworkJitter = (DBGROUP_TEST_NETWORK_JITTER_NS);
+
+constexpr size_t kNetworkBandwidth = (DBGROUP_TEST_NETWORK_BANDWIDTH_MBPS);
+
+constexpr size_t kBulkloadNum = (DBGROUP_TEST_BULKLOAD_NUM);
+
+constexpr size_t kTimelineInterval = (DBGROUP_TEST_TIMELINE_INTERVAL_MS);
+
+constexpr size_t kPhaseDuration = (DBGROUP_TEST_PHASE_DURATION_MS);
+
+constexpr size_t kWarmupDuration = (DBGROUP_TEST_WARMUP_DURATION_MS);
+
+constexpr size_t kCooldownDuration = (DBGROUP_TEST_COOLDOWN_DURATION_MS);
+
+constexpr size_t kHotKeyNum = (DBGROUP_TEST_HOT_KEY_NUM);
+
+constexpr size_t kMissPercent = (DBGROUP_TEST_MISS_PERCENT);
+
 constexpr size_t kVarDataLength = (DBGROUP_TEST_MAX_VARLEN_DATA_SIZE);
 
 constexpr int32_t kPadNum = kVarDataLength / 10;
 
+constexpr size_t kCacheLineSize = 64;
+
 constexpr bool kExpectSuccess = true;
 
 constexpr bool kExpectFailed = false;
@@ -94,6 +170,12 @@ constexpr bool kWithWrite = true;
 
 constexpr bool kWithDelete = true;
 
+constexpr bool kWithGaps = true;
+
+constexpr bool kTimeBounded = true;
+
+constexpr bool kPresorted = true;
+
 #ifdef DBGROUP_TEST_DISABLE_RECORD_MERGING
 constexpr bool kDisableRecordMerging = true;
 #else
@@ -106,6 +188,12 @@ constexpr bool kDisableScanVerifyTest = true;
 constexpr bool kDisableScanVerifyTest = false;
 #endif
 
+#ifdef DBGROUP_TEST_VERIFY_SCAN_WITH_CHECKSUM
+constexpr bool kVerifyScanWithChecksum = true;
+#else
+constexpr bool kVerifyScanWithChecksum = false;
+#endif
+
 /*############################################################################*
  * Global utility classes
  *############################################################################*/
@@ -163,6 +251,49 @@ struct DummyIter {
   }
 };
 
+/**
+ * @brief An iterator of a range scan that owns the buffer of its end key.
+ *
+ * @tparam Iter The class of a wrapped iterator.
+ */
+template <class Iter>
+class BoundedIter
+{
+ public:
+  BoundedIter(  //
+      std::unique_ptr<VarData> end,
+      Iter iter)
+      : end_{std::move(end)}, iter_{std::move(iter)}
+  {
+  }
+
+  explicit
+  operator bool()
+  {
+    return static_cast<bool>(iter_);
+  }
+
+  auto
+  operator*()  //
+      -> decltype(auto)
+  {
+    return *iter_;
+  }
+
+  void
+  operator++()
+  {
+    ++iter_;
+  }
+
+ private:
+  /// @brief The end key referred by the wrapped iterator.
+  std::unique_ptr<VarData> end_{};
+
+  /// @brief The wrapped iterator.
+  Iter iter_{};
+};
+
 /*############################################################################*
  * Type definitions for templated tests
  *############################################################################*/
@@ -408,6 +539,113 @@ ReleaseTestData(  //
   }
 }
 
+/**
+ * @param id A key ID.
+ * @return A hash value for scattering sequential IDs (SplitMix64).
+ */
+constexpr auto
+HashID(  //
+    const size_t id)  //
+    -> uint64_t
+{
+  auto x = static_cast<uint64_t>(id) + 0x9E3779B97F4A7C15UL;
+  x = (x ^ (x >> 30U)) * 0xBF58476D1CE4E5B9UL;
+  x = (x ^ (x >> 27U)) * 0x94D049BB133111EBUL;
+  return x ^ (x >> 31U);
+}
+
+/**
+ * @param key A target key.
+ * @return The hash value of the given key's content.
+ */
+template <class Key>
+auto
+HashKey(                      //
+    const Key& key) noexcept  //
+    -> size_t
+{
+  if constexpr (std::is_integral_v<Key>) {
+    return HashID(static_cast<size_t>(key));  // scatter sequential keys
+  } else if constexpr (IsVarLenData<Key>()) {
+    return std::hash<std::string_view>{}({key, GetLength(key) - 1});
+  } else if constexpr (std::is_pointer_v<Key>) {
+    return HashKey(*key);
+  } else {
+    return std::hash<std::string_view>{}({std::bit_cast<const char*>(&key), sizeof(Key)});
+  }
+}
+
+/**
+ * @brief Check whether a given key is in a gap between present keys.
+ *
+ * Since test keys are sorted by their IDs, gap keys interleave with the others.
+ * The odd pattern makes every other key absent, and the hashed one makes gaps
+ * of random widths.
+ *
+ * @param id A key ID.
+ * @param pattern A pattern of gaps.
+ * @retval true if a given key should be absent.
+ * @retval false otherwise.
+ */
+constexpr auto
+IsGapKey(  //
+    const size_t id,
+    const GapPattern pattern = kOddGaps)  //
+    -> bool
+{
+  return (pattern == kOddGaps) ? id % 2 == 1 : HashID(id) % 2 == 1;
+}
+
+/**
+ * @brief Compute the node whose workers access a given key.
+ *
+ * With the range/hash partitioning, each key is owned by one node. With the
+ * skewed partitioning, each node accesses the keys in its range partition
+ * except for the last `remote_percent` percent of them, which are accessed by
+ * the previous node as remote ones instead.
+ *
+ * @param id A key ID.
+ * @param policy A key-partitioning policy (must not be `kSharedKeys`).
+ * @param node_num The number of nodes.
+ * @param key_num The number of keys.
+ * @param remote_percent The percentage of remote keys for the skewed policy.
+ * @return The ID of the owner node.
+ */
+constexpr auto
+GetOwnerNode(  //
+    const size_t id,
+    const KeyPartition policy = kKeyPartition,
+    const size_t node_num = kNodeNum,
+    const size_t key_num = kExecNum,
+    const size_t remote_percent = kRemotePercent)  //
+    -> size_t
+{
+  if (policy == kHashPartition) return HashID(id) % node_num;
+
+  const auto node = id * node_num / key_num;
+  if (policy != kSkewedPartition) return node;
+
+  const auto begin = (node * key_num + node_num - 1) / node_num;
+  const auto end = ((node + 1) * key_num + node_num - 1) / node_num;
+  const auto remote_begin = end - (end - begin) * remote_percent / 100;
+  return (id < remote_begin) ? node : (node + node_num - 1) % node_num;
+}
+
+/**
+ * @param id A key ID.
+ * @param node_id A node ID.
+ * @retval true if the workers of a given node access a given key.
+ * @retval false otherwise.
+ */
+constexpr auto
+IsTargetKey(  //
+    const size_t id,
+    const size_t node_id)  //
+    -> bool
+{
+  return kKeyPartition == kSharedKeys || GetOwnerNode(id) == node_id;
+}
+
 template <class T>
 constexpr auto
 AddMerger(  //
@@ -418,6 +656,361 @@ AddMerger(  //
   return lhs + rhs;
 }
 
+/*############################################################################*
+ * Bulkload inputs
+ *############################################################################*/
+
+/**
+ * @brief A sorted input range for bulkloading that produces entries lazily.
+ *
+ * Each entry (i.e., a tuple of a key, a payload, and a key length) is produced
+ * when it is accessed, so the input does not double peak memory consumption.
+ * Fixed-length keys are generated from their IDs, and thus the number of
+ * entries may exceed the number of prepared keys. Variable-length and pointer
+ * keys refer to prepared ones because indexes may retain their addresses.
+ *
+ * @tparam Key A class of keys.
+ * @tparam Payload A class of payloads.
+ */
+template <class Key, class Payload>
+class BulkloadInput
+{
+ public:
+  /*##########################################################################*
+   * Public types
+   *##########################################################################*/
+
+  using Entry = std::tuple<Key, Payload, size_t>;
+
+  /// @brief A forward iterator producing entries.
+  class Iterator
+  {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Entry;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = Entry;
+
+    constexpr Iterator() = default;
+
+    constexpr Iterator(  //
+        const BulkloadInput* input,
+        const size_t pos)
+        : input_{input}, pos_{pos}
+    {
+    }
+
+    auto
+    operator*() const  //
+        -> Entry
+    {
+      return (*input_)[pos_];
+    }
+
+    auto
+    operator++()  //
+        -> Iterator&
+    {
+      ++pos_;
+      return *this;
+    }
+
+    auto
+    operator++(int)  //
+        -> Iterator
+    {
+      auto prev = *this;
+      ++pos_;
+      return prev;
+    }
+
+    auto operator==(const Iterator&) const -> bool = default;
+
+   private:
+    /// @brief The original input.
+    const BulkloadInput* input_{};
+
+    /// @brief The ID of the current entry.
+    size_t pos_{};
+  };
+
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @param keys Prepared keys.
+   * @param rec_num The number of entries (pointer keys are limited to `keys`).
+   */
+  BulkloadInput(  //
+      const std::vector<Key>& keys,
+      const size_t rec_num)
+      : keys_{&keys}, size_{kUseKeys ? std::min(rec_num, keys.size()) : rec_num}
+  {
+  }
+
+  /*##########################################################################*
+   * Public getters
+   *##########################################################################*/
+
+  [[nodiscard]] auto
+  size() const noexcept  //
+      -> size_t
+  {
+    return size_;
+  }
+
+  /**
+   * @param i The ID of an entry.
+   * @return The `i`-th entry in sorted order.
+   */
+  auto
+  operator[](  //
+      const size_t i) const  //
+      -> Entry
+  {
+    if constexpr (kUseKeys) {
+      const auto& key = (*keys_)[i];
+      return {key, Payload{1}, GetLength(key)};
+    } else {
+      const auto key = static_cast<Key>(i);
+      return {key, Payload{1}, sizeof(Key)};
+    }
+  }
+
+  [[nodiscard]] auto
+  begin() const  //
+      -> Iterator
+  {
+    return Iterator{this, 0};
+  }
+
+  [[nodiscard]] auto
+  end() const  //
+      -> Iterator
+  {
+    return Iterator{this, size_};
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief A flag for referring to prepared keys.
+  static constexpr bool kUseKeys = std::is_pointer_v<Key>;
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief Prepared keys.
+  const std::vector<Key>* keys_{};
+
+  /// @brief The number of entries.
+  size_t size_{};
+};
+
+/**
+ * @brief Sort values with multiple threads.
+ *
+ * Each thread sorts its own chunk, and then adjacent chunks are merged in
+ * parallel until one chunk remains.
+ *
+ * @param vals Target values.
+ * @param comp A comparator for values.
+ * @param thread_num The number of threads.
+ */
+template <class T, class Comp>
+void
+ParallelSort(  //
+    std::vector<T>& vals,
+    const Comp& comp,
+    const size_t thread_num)
+{
+  const auto n = vals.size();
+  const auto chunk_num = std::max<size_t>(std::min(thread_num, n), 1);
+  std::vector<size_t> bounds{};
+  for (size_t i = 0; i <= chunk_num; ++i) {
+    bounds.emplace_back(n * i / chunk_num);
+  }
+
+  auto run = [](std::vector<std::thread>& threads) {
+    for (auto&& t : threads) {
+      t.join();
+    }
+    threads.clear();
+  };
+  std::vector<std::thread> threads{};
+  for (size_t i = 0; i < chunk_num; ++i) {
+    threads.emplace_back([&, i] {
+      std::sort(vals.begin() + bounds[i], vals.begin() + bounds[i + 1], comp);
+    });
+  }
+  run(threads);
+
+  for (size_t width = 1; width < chunk_num; width *= 2) {
+    for (size_t i = 0; i + width < chunk_num; i += 2 * width) {
+      const auto end = bounds[std::min(i + 2 * width, chunk_num)];
+      threads.emplace_back([&, i, width, end] {
+        std::inplace_merge(vals.begin() + bounds[i], vals.begin() + bounds[i + width],
+                           vals.begin() + end, comp);
+      });
+    }
+    run(threads);
+  }
+}
+
+/*############################################################################*
+ * Scan checksums
+ *############################################################################*/
+
+/**
+ * @brief An order-independent checksum of scanned records.
+ *
+ * Since each record is hashed independently and summed up, the expected
+ * checksum of any range of keys is given by the difference of prefix sums. The
+ * order of records is checked separately by comparing each key with the
+ * previous one, which is copied because scanned keys may be invalidated by
+ * moving iterators.
+ *
+ * @tparam Key A class of keys.
+ * @tparam Payload A class of payloads.
+ * @tparam Comp A comparator for keys.
+ */
+template <class Key, class Payload, class Comp>
+class ScanChecksum
+{
+  /*##########################################################################*
+   * Type aliases
+   *##########################################################################*/
+
+  using KeyBuf = std::conditional_t<IsVarLenData<Key>(), VarData, std::remove_pointer_t<Key>>;
+
+ public:
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @param reverse A flag for expecting keys in descending order.
+   */
+  explicit ScanChecksum(  //
+      const bool reverse = false)
+      : reverse_{reverse}
+  {
+  }
+
+  ScanChecksum(const ScanChecksum&) = delete;
+  ScanChecksum(ScanChecksum&&) = delete;
+
+  auto operator=(const ScanChecksum&) -> ScanChecksum& = delete;
+  auto operator=(ScanChecksum&&) -> ScanChecksum& = delete;
+
+  ~ScanChecksum() = default;
+
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @param key A target key.
+   * @return The hash value of the key in checksums.
+   */
+  [[nodiscard]] static auto
+  GetKeyHash(  //
+      const Key& key)  //
+      -> uint64_t
+  {
+    return HashKey(key);
+  }
+
+  /**
+   * @param payload A target payload.
+   * @return The hash value of the payload in checksums.
+   */
+  [[nodiscard]] static auto
+  GetPayloadHash(  //
+      const Payload& payload)  //
+      -> uint64_t
+  {
+    // rehash payloads to distinguish them from keys with the same values
+    return HashID(HashKey(payload));
+  }
+
+  /**
+   * @brief Add a scanned record to this checksum.
+   *
+   * @param key A scanned key.
+   * @param payload A scanned payload.
+   * @retval true if the key follows the previous one in the scan order.
+   * @retval false otherwise (the record is not added).
+   */
+  auto
+  Add(  //
+      const Key& key,
+      const Payload& payload)  //
+      -> bool
+  {
+    constexpr Comp kLess{};
+    if (rec_num_ > 0 && !(reverse_ ? kLess(key, prev_) : kLess(prev_, key))) return false;
+
+    sum_ += GetKeyHash(key) + GetPayloadHash(payload);
+    ++rec_num_;
+    if constexpr (IsVarLenData<Key>()) {
+      std::memcpy(buf_.data, key, GetLength(key));
+      prev_ = buf_.data;
+    } else if constexpr (std::is_pointer_v<Key>) {
+      buf_ = *key;
+      prev_ = &buf_;
+    } else {
+      prev_ = key;
+    }
+    return true;
+  }
+
+  /**
+   * @return The sum of the hash values of added records.
+   */
+  [[nodiscard]] auto
+  GetSum() const noexcept  //
+      -> uint64_t
+  {
+    return sum_;
+  }
+
+  /**
+   * @return The number of added records.
+   */
+  [[nodiscard]] auto
+  GetRecordNum() const noexcept  //
+      -> size_t
+  {
+    return rec_num_;
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief A flag for expecting keys in descending order.
+  bool reverse_{};
+
+  /// @brief The sum of the hash values of added records.
+  uint64_t sum_{};
+
+  /// @brief The number of added records.
+  size_t rec_num_{};
+
+  /// @brief The previous key.
+  Key prev_{};
+
+  /// @brief A buffer for retaining the content of the previous key.
+  KeyBuf buf_{};
+};
+
 }  // namespace test
 }  // namespace dbgroup::index
 
@@ -0,0 +1,392 @@
+/*
+ * Copyright 2026 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_INDEX_FIXTURES_COMPARISON_RUNNER_HPP
+#define DBGROUP_INDEX_FIXTURES_COMPARISON_RUNNER_HPP
+
+// C++ standard libraries
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+// system libraries
+#include <cxxabi.h>
+
+// external libraries
+#include <gtest/gtest.h>
+
+// external C++ libraries
+#include <dbgroup/index/concepts.hpp>
+#include <dbgroup/index/utility.hpp>
+
+// local sources
+#include "common.hpp"
+#include "concepts.hpp"
+#include "index_wrapper.hpp"
+#include "metrics.hpp"
+
+namespace dbgroup::index::test
+{
+/*############################################################################*
+ * Global utility functions
+ *############################################################################*/
+
+/**
+ * @tparam T A target type.
+ * @return The unqualified name of a given type without template arguments.
+ */
+template <class T>
+auto
+GetShortTypeName()  //
+    -> std::string
+{
+  int status{};
+  auto* demangled = abi::__cxa_demangle(typeid(T).name(), nullptr, nullptr, &status);
+  std::string name = (status == 0) ? demangled : typeid(T).name();
+  std::free(demangled);  // NOLINT
+
+  name = name.substr(0, name.find('<'));
+  if (const auto pos = name.rfind("::"); pos != std::string::npos) {
+    name = name.substr(pos + 2);
+  }
+  return name;
+}
+
+/*############################################################################*
+ * Global utility classes
+ *############################################################################*/
+
+/**
+ * @brief The measured performance of one workload phase for one target.
+ *
+ */
+struct ComparisonResult {
+  /// @brief The name of a target index.
+  std::string index{};
+
+  /// @brief The name of a key type.
+  std::string key{};
+
+  /// @brief The name of a payload type.
+  std::string payload{};
+
+  /// @brief The name of a workload phase.
+  std::string phase{};
+
+  /// @brief The number of executed operations.
+  size_t ops{};
+
+  /// @brief Throughput [ops/s].
+  double throughput{};
+
+  /// @brief Throughput relative to the first target with the same key/payload.
+  double relative{};
+
+  /// @brief Latency percentiles [ns].
+  uint64_t p50{};
+  uint64_t p99{};
+  uint64_t p999{};
+
+  /// @brief Memory consumption per key [bytes] after loading.
+  double memory_per_key{};
+};
+
+/**
+ * @brief A runner for executing an identical workload over several indexes.
+ *
+ * Every target is loaded with the same keys and then runs read, update, scan,
+ * and delete phases if it supports them. All the targets process the same
+ * operation sequences with the same thread assignment, so the results are
+ * directly comparable.
+ *
+ * @tparam TestTargets `::testing::Types` of `IndexInfo`.
+ */
+template <class TestTargets>
+class ComparisonRunner;
+
+template <class... IndexInfos>
+class ComparisonRunner<::testing::Types<IndexInfos...>>
+{
+ public:
+  /*##########################################################################*
+   * Public constants
+   *##########################################################################*/
+
+  /// @brief The number of records read by each scan operation.
+  static constexpr size_t kScanLength = 100;
+
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  explicit ComparisonRunner(  //
+      const size_t thread_num = kThreadNum)
+      : thread_num_{std::max<size_t>(thread_num, 1)}
+  {
+    std::mt19937_64 rand_engine{kRandomSeed};
+    ids_.reserve(kExecNum);
+    for (size_t i = 0; i < kExecNum; ++i) {
+      ids_.emplace_back(i);
+    }
+    std::shuffle(ids_.begin(), ids_.end(), rand_engine);
+  }
+
+  /*##########################################################################*
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Run the workload over all the targets.
+   *
+   */
+  void
+  Run()
+  {
+    results_.clear();
+    (RunTarget<IndexInfos>(), ...);
+  }
+
+  /**
+   * @return The measured results.
+   */
+  [[nodiscard]] auto
+  GetResults() const  //
+      -> const std::vector<ComparisonResult>&
+  {
+    return results_;
+  }
+
+  /**
+   * @brief Print the results as a side-by-side table.
+   *
+   * @param out An output stream.
+   */
+  void
+  PrintTable(  //
+      std::ostream& out = std::cout) const
+  {
+    out << std::left << std::setw(24) << "index" << std::setw(8) << "key"  //
+        << std::setw(8) << "payload" << std::setw(8) << "phase"            //
+        << std::right << std::setw(14) << "ops/s" << std::setw(8) << "ratio"
+        << std::setw(10) << "p50[ns]" << std::setw(10) << "p99[ns]"  //
+        << std::setw(11) << "p99.9[ns]" << std::setw(10) << "B/key" << '\n';
+    for (const auto& r : results_) {
+      out << std::left << std::setw(24) << r.index << std::setw(8) << r.key  //
+          << std::setw(8) << r.payload << std::setw(8) << r.phase            //
+          << std::right << std::fixed << std::setprecision(0) << std::setw(14) << r.throughput
+          << std::setprecision(2) << std::setw(8) << r.relative  //
+          << std::setw(10) << r.p50 << std::setw(10) << r.p99 << std::setw(11) << r.p999
+          << std::setprecision(1) << std::setw(10) << r.memory_per_key << '\n';
+    }
+    out << std::defaultfloat;
+  }
+
+  /**
+   * @brief Write the results in the CSV format.
+   *
+   * @param path The path of an output file.
+   */
+  void
+  WriteCSV(  //
+      const std::string& path) const
+  {
+    std::ofstream out{path};
+    out << "index,key,payload,phase,ops,throughput,relative_throughput,"
+           "p50_ns,p99_ns,p999_ns,memory_per_key\n";
+    for (const auto& r : results_) {
+      out << r.index << ',' << r.key << ',' << r.payload << ',' << r.phase << ','  //
+          << r.ops << ',' << r.throughput << ',' << r.relative << ','              //
+          << r.p50 << ',' << r.p99 << ',' << r.p999 << ',' << r.memory_per_key << '\n';
+    }
+  }
+
+  /**
+   * @brief Write the results in the JSON format.
+   *
+   * @param path The path of an output file.
+   */
+  void
+  WriteJSON(  //
+      const std::string& path) const
+  {
+    std::ofstream out{path};
+    out << "[\n";
+    for (size_t i = 0; i < results_.size(); ++i) {
+      const auto& r = results_[i];
+      out << R"(  {"index": ")" << r.index << R"(", "key": ")" << r.key  //
+          << R"(", "payload": ")" << r.payload << R"(", "phase": ")" << r.phase
+          << R"(", "ops": )" << r.ops << R"(, "throughput": )" << r.throughput
+          << R"(, "relative_throughput": )" << r.relative  //
+          << R"(, "p50_ns": )" << r.p50 << R"(, "p99_ns": )" << r.p99
+          << R"(, "p999_ns": )" << r.p999 << R"(, "memory_per_key": )" << r.memory_per_key
+          << ((i + 1 < results_.size()) ? "},\n" : "}\n");
+    }
+    out << "]\n";
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal utilities
+   *##########################################################################*/
+
+  template <class IndexInfo>
+  void
+  RunTarget()
+  {
+    using Key = typename IndexInfo::Key::Data;
+    using Payload = typename IndexInfo::Payload::Data;
+    using Index = typename IndexInfo::Index;
+    using IndexWrapper_t = IndexWrapper<IndexInfo>;
+
+    constexpr auto kHasWrite = HasWrite<Index, Key, Payload>();
+    constexpr auto kHasInsert = HasInsert<Index, Key, Payload>();
+    constexpr auto kHasBulkload = HasBulkload<Index, Key, Payload>();
+    if constexpr (!kHasWrite && !kHasInsert && !kHasBulkload) return;
+
+    auto keys = PrepareTestData<Key>(kExecNum);
+    const auto heap_begin = GetHeapUsage();
+    auto index = std::make_unique<IndexWrapper_t>(keys);
+    index->SetUp();
+
+    ComparisonResult base{};
+    base.index = GetShortTypeName<Index>();
+    base.key = GetShortTypeName<typename IndexInfo::Key>();
+    base.payload = GetShortTypeName<typename IndexInfo::Payload>();
+    const auto first = results_.size();
+
+    if constexpr (kHasWrite) {
+      RunPhase(*index, base, "load", [&](const size_t id) { index->Write(id); });
+    } else if constexpr (kHasInsert) {
+      RunPhase(*index, base, "load", [&](const size_t id) { index->Insert(id); });
+    } else {
+      const auto begin = GetTimestamp();
+      index->Bulkload();
+      const auto lat = GetTimestamp() - begin;
+      AddResult(base, "load", kExecNum, lat, std::vector<uint64_t>{lat});
+    }
+
+    const auto mem_usage = GetIndexMemoryUsage<Index>(*index, heap_begin);
+
+    if constexpr (HasRead<Index, Key, Payload>()) {
+      RunPhase(*index, base, "read", [&](const size_t id) { index->Read(id); });
+    }
+    if constexpr (HasUpdate<Index, Key, Payload>()) {
+      RunPhase(*index, base, "update", [&](const size_t id) { index->Update(id); });
+    }
+    if constexpr (HasScan<Index, Key, Payload>()) {
+      RunPhase(*index, base, "scan", [&](const size_t id) {
+        auto&& iter = index->Scan(id, kClosed, std::min(id + kScanLength, kExecNum) - 1, kClosed);
+        for (; iter; ++iter) {
+        }
+      });
+    }
+    if constexpr (HasDelete<Index, Key, Payload>()) {
+      RunPhase(*index, base, "delete", [&](const size_t id) { index->Delete(id); });
+    }
+
+    for (size_t i = first; i < results_.size(); ++i) {
+      results_[i].memory_per_key = static_cast<double>(mem_usage) / kExecNum;
+    }
+
+    index->TearDown();
+    index.reset();
+    ReleaseTestData(keys);
+  }
+
+  template <class IndexWrapper_t, class Func>
+  void
+  RunPhase(  //
+      IndexWrapper_t& index,
+      const ComparisonResult& base,
+      const std::string& phase,
+      const Func& op)
+  {
+    // time only the gated section, i.e., after all the workers have set up
+    LatencyRecorder latency{thread_num_};
+    std::vector<uint64_t> begins(thread_num_);
+    std::vector<uint64_t> ends(thread_num_);
+    for (size_t w_id = 0; w_id < thread_num_; ++w_id) {
+      latency.Reserve(w_id, kExecNum / thread_num_ + 1);
+    }
+    index.RunWorkers(thread_num_, [&](const size_t w_id) {
+      begins[w_id] = GetTimestamp();
+      for (size_t i = w_id; i < kExecNum; i += thread_num_) {
+        const auto begin = GetTimestamp();
+        op(ids_[i]);
+        latency.Record(w_id, begin, GetTimestamp());
+      }
+      ends[w_id] = GetTimestamp();
+    });
+    const auto begin = *std::min_element(begins.begin(), begins.end());
+    const auto end = *std::max_element(ends.begin(), ends.end());
+
+    AddResult(base, phase, kExecNum, end - begin, latency.GetLatencies());
+  }
+
+  void
+  AddResult(  //
+      const ComparisonResult& base,
+      const std::string& phase,
+      const size_t ops,
+      const uint64_t elapsed,
+      std::vector<uint64_t> lats)
+  {
+    auto result = base;
+    result.phase = phase;
+    result.ops = ops;
+    result.throughput = static_cast<double>(ops) * 1e9 / static_cast<double>(elapsed);
+    result.p50 = GetQuantile(lats, 0.5);
+    result.p99 = GetQuantile(lats, 0.99);
+    result.p999 = GetQuantile(lats, 0.999);
+
+    // the first target with the same key/payload types is the baseline
+    result.relative = 1.0;
+    for (const auto& r : results_) {
+      if (r.key == result.key && r.payload == result.payload && r.phase == result.phase) {
+        result.relative = result.throughput / r.throughput;
+        break;
+      }
+    }
+
+    results_.emplace_back(std::move(result));
+  }
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The number of worker threads.
+  size_t thread_num_{kThreadNum};
+
+  /// @brief A shuffled sequence of key IDs shared by all the targets.
+  std::vector<size_t> ids_{};
+
+  /// @brief The measured results.
+  std::vector<ComparisonResult> results_{};
+};
+
+}  // namespace dbgroup::index::test
+
+#endif  // DBGROUP_INDEX_FIXTURES_COMPARISON_RUNNER_HPP
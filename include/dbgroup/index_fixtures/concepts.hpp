@@ -0,0 +1,354 @@
+/*
+ * Copyright 2026 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_INDEX_FIXTURES_CONCEPTS_HPP
+#define DBGROUP_INDEX_FIXTURES_CONCEPTS_HPP
+
+// C++ standard libraries
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <tuple>
+
+// local sources
+#include "common.hpp"
+
+namespace dbgroup::index::test
+{
+/*############################################################################*
+ * Type aliases for optional hooks
+ *############################################################################*/
+
+/// @brief A callback for notifying the fixtures of structure modifications.
+using SMOHandler = std::function<void(SMOType)>;
+
+/*############################################################################*
+ * Optional capabilities of indexes
+ *############################################################################*/
+
+/**
+ * @tparam Index A target index class.
+ * @tparam Key A class of keys.
+ * @tparam Payload A class of payloads.
+ * @retval true if the index bulkloads a lazily produced input range via
+ * `Bulkload(const BulkloadInput<Key, Payload>&, size_t)`.
+ * @retval false otherwise.
+ */
+template <class Index, class Key, class Payload>
+constexpr auto
+HasBulkloadInput()  //
+    -> bool
+{
+  return requires(Index& idx, const BulkloadInput<Key, Payload>& input) {
+    idx.Bulkload(input, size_t{});
+  };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @retval true if the index declares `static constexpr bool kOnlineBulkload =
+ * true`, i.e., it can serve reads and scans while bulkloading.
+ * @retval false otherwise.
+ */
+template <class Index>
+constexpr auto
+HasOnlineBulkload()  //
+    -> bool
+{
+  return requires { requires Index::kOnlineBulkload; };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @retval true if the index declares `static constexpr bool kAllowDuplicates =
+ * true`, i.e., `Insert` stores multiple payloads per key.
+ * @retval false otherwise.
+ */
+template <class Index>
+constexpr auto
+HasDuplicateKeys()  //
+    -> bool
+{
+  return requires { requires Index::kAllowDuplicates; };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @tparam Key A class of keys.
+ * @tparam Payload A class of payloads.
+ * @retval true if the index deletes a specific pair of a key and a payload via
+ * `Delete(const Key&, const Payload&, size_t)`.
+ * @retval false otherwise.
+ */
+template <class Index, class Key, class Payload>
+constexpr auto
+HasPairDelete()  //
+    -> bool
+{
+  return requires(Index& idx, const Key& key, const Payload& payload) {
+    idx.Delete(key, payload, size_t{});
+  };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @tparam Key A class of keys.
+ * @retval true if the index deletes all the records in a range via
+ * `DeleteRange(const ScanKey&, const ScanKey&)`, which returns the number of
+ * deleted records.
+ * @retval false otherwise.
+ */
+template <class Index, class Key>
+constexpr auto
+HasDeleteRange()  //
+    -> bool
+{
+  using ScanKey = std::optional<std::tuple<Key, size_t, bool>>;
+  return requires(Index& idx, const ScanKey& scan_key) {
+    { idx.DeleteRange(scan_key, scan_key) } -> std::convertible_to<size_t>;
+  };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @tparam Key A class of keys.
+ * @retval true if the index scans all the records whose keys start with a given
+ * prefix via `ScanPrefix(const Key&, size_t)`.
+ * @retval false otherwise.
+ */
+template <class Index, class Key>
+constexpr auto
+HasScanPrefix()  //
+    -> bool
+{
+  return requires(Index& idx, const Key& key) { idx.ScanPrefix(key, size_t{}); };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @tparam Key A class of keys.
+ * @tparam Payload A class of payloads.
+ * @retval true if the index conditionally updates a record via
+ * `CompareAndSwap(const Key&, const Payload&, const Payload&, size_t)`, which
+ * returns the payload before the operation.
+ * @retval false otherwise.
+ */
+template <class Index, class Key, class Payload>
+constexpr auto
+HasCompareAndSwap()  //
+    -> bool
+{
+  return requires(Index& idx, const Key& key, const Payload& payload) {
+    idx.CompareAndSwap(key, payload, payload, size_t{});
+  };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @tparam Key A class of keys.
+ * @retval true if the index pins snapshots via `GetSnapshot()` and
+ * `ReleaseSnapshot(uint64_t)` and reads them via `ReadAt(const Key&, uint64_t,
+ * size_t)`.
+ * @retval false otherwise.
+ */
+template <class Index, class Key>
+constexpr auto
+HasSnapshotRead()  //
+    -> bool
+{
+  return requires(Index& idx, const Key& key) {
+    { idx.GetSnapshot() } -> std::convertible_to<uint64_t>;
+    idx.ReleaseSnapshot(uint64_t{});
+    idx.ReadAt(key, uint64_t{}, size_t{});
+  };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @tparam Key A class of keys.
+ * @retval true if the index scans a pinned snapshot via `ScanAt(uint64_t,
+ * const ScanKey&, const ScanKey&)`.
+ * @retval false otherwise.
+ */
+template <class Index, class Key>
+constexpr auto
+HasSnapshotScan()  //
+    -> bool
+{
+  using ScanKey = std::optional<std::tuple<Key, size_t, bool>>;
+  return requires(Index& idx, const ScanKey& scan_key) {
+    idx.ScanAt(uint64_t{}, scan_key, scan_key);
+  };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @retval true if the index reports the total number of record versions via
+ * `GetVersionCount()`.
+ * @retval false otherwise.
+ */
+template <class Index>
+constexpr auto
+HasVersionCount()  //
+    -> bool
+{
+  return requires(Index& idx) {
+    { idx.GetVersionCount() } -> std::convertible_to<size_t>;
+  };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @retval true if the index reports SMOs via `SetSMOHandler(SMOHandler)`.
+ * @retval false otherwise.
+ */
+template <class Index>
+constexpr auto
+HasSMOHandler()  //
+    -> bool
+{
+  return requires(Index& idx, SMOHandler handler) { idx.SetSMOHandler(handler); };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @retval true if the index reports its memory usage in bytes via
+ * `GetMemoryUsage()`.
+ * @retval false otherwise.
+ */
+template <class Index>
+constexpr auto
+HasMemoryUsage()  //
+    -> bool
+{
+  return requires(Index& idx) {
+    { idx.GetMemoryUsage() } -> std::convertible_to<size_t>;
+  };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @retval true if the index reports the total number of retried operations via
+ * `GetRetryCount()`.
+ * @retval false otherwise.
+ */
+template <class Index>
+constexpr auto
+HasRetryCount()  //
+    -> bool
+{
+  return requires(Index& idx) {
+    { idx.GetRetryCount() } -> std::convertible_to<size_t>;
+  };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @retval true if the index can consolidate merged records via `Consolidate()`.
+ * @retval false otherwise.
+ */
+template <class Index>
+constexpr auto
+HasConsolidate()  //
+    -> bool
+{
+  return requires(Index& idx) { idx.Consolidate(); };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @retval true if the index reports the number of its nodes via
+ * `GetNodeCount()`.
+ * @retval false otherwise.
+ */
+template <class Index>
+constexpr auto
+HasNodeCount()  //
+    -> bool
+{
+  return requires(Index& idx) {
+    { idx.GetNodeCount() } -> std::convertible_to<size_t>;
+  };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @retval true if the index reports the average fill factor of its nodes via
+ * `GetFillFactor()`.
+ * @retval false otherwise.
+ */
+template <class Index>
+constexpr auto
+HasFillFactor()  //
+    -> bool
+{
+  return requires(Index& idx) {
+    { idx.GetFillFactor() } -> std::convertible_to<double>;
+  };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @tparam Key A class of keys.
+ * @retval true if the index exposes its hash function via a static
+ * `GetHash(const Key&)`.
+ * @retval false otherwise.
+ */
+template <class Index, class Key>
+constexpr auto
+HasKeyHash()  //
+    -> bool
+{
+  return requires(const Key& key) {
+    { Index::GetHash(key) } -> std::convertible_to<size_t>;
+  };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @retval true if the index reports the ratio of used slots via
+ * `GetLoadFactor()`.
+ * @retval false otherwise.
+ */
+template <class Index>
+constexpr auto
+HasLoadFactor()  //
+    -> bool
+{
+  return requires(Index& idx) {
+    { idx.GetLoadFactor() } -> std::convertible_to<double>;
+  };
+}
+
+/**
+ * @tparam Index A target index class.
+ * @retval true if the index can preallocate space for a given number of
+ * records via `Reserve(size_t)`.
+ * @retval false otherwise.
+ */
+template <class Index>
+constexpr auto
+HasReserve()  //
+    -> bool
+{
+  return requires(Index& idx) { idx.Reserve(size_t{}); };
+}
+
+}  // namespace dbgroup::index::test
+
+#endif  // DBGROUP_INDEX_FIXTURES_CONCEPTS_HPP
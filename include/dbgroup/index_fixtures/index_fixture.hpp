@@ -19,10 +19,17 @@
 
 // C++ standard libraries
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
 #include <memory>
+#include <numeric>
+#include <optional>
 #include <random>
+#include <string>
 #include <vector>
 
 // external libraries
@@ -34,7 +41,9 @@
 
 // local sources
 #include "common.hpp"
+#include "concepts.hpp"
 #include "index_wrapper.hpp"
+#include "metrics.hpp"
 
 namespace dbgroup::index::test
 {
@@ -54,6 +63,7 @@ class IndexFixture : public ::testing::Test
   using Comp = typename IndexInfo::Key::Comp;
   using Index = typename IndexInfo::Index;
   using IndexWrapper_t = IndexWrapper<IndexInfo>;
+  using Checksum = ScanChecksum<Key, Payload, Comp>;
 
  protected:
   /*##########################################################################*
@@ -64,6 +74,50 @@ class IndexFixture : public ::testing::Test
   static constexpr size_t kRecNumWithLeafSMOs = 1000;
   static constexpr size_t kRecNumWithInternalSMOs = 30000;
   static constexpr uint32_t kUpdDelta = kDisableRecordMerging ? 0 : 1;
+  static constexpr size_t kShrinkPercent = 90;
+  static constexpr size_t kClusterSize = 1000;
+  static constexpr size_t kMaxMergeDepth = 64;
+  static constexpr size_t kBulkloadSizeNum = 3;
+  static constexpr std::array<size_t, 4> kRangeSizes = {1, 16, 256, 4096};
+  static constexpr size_t kMaxRangeNum = 100;
+  static constexpr bool kReverseScan = true;
+
+  /*##########################################################################*
+   * Internal types
+   *##########################################################################*/
+
+  /// @brief Statistics of an index before/after shrinking.
+  struct ShrinkStats {
+    /// @brief The number of live records.
+    size_t rec_num{};
+
+    /// @brief The number of nodes reported by the index.
+    std::optional<size_t> node_num{};
+
+    /// @brief The average fill factor reported by the index.
+    std::optional<double> fill_factor{};
+
+    /// @brief Memory consumption [bytes].
+    size_t memory{};
+
+    /// @brief Read throughput over live records [ops/s].
+    double read_tput{};
+
+    /// @brief Full-scan throughput [records/s].
+    double scan_tput{};
+  };
+
+  /// @brief Read latency over a set of records.
+  struct ReadLatency {
+    /// @brief Average latency [ns].
+    uint64_t avg{};
+
+    /// @brief Median latency [ns].
+    uint64_t p50{};
+
+    /// @brief 99th percentile latency [ns].
+    uint64_t p99{};
+  };
 
   /*##########################################################################*
    * Setup/Teardown
@@ -85,6 +139,14 @@ class IndexFixture : public ::testing::Test
     random = forward;
     std::mt19937_64 rand_engine{kRandomSeed};
     std::shuffle(random.begin(), random.end(), rand_engine);
+
+    if constexpr (kVerifyScanWithChecksum) {
+      key_hash_sums.reserve(kExecNum + 1);
+      key_hash_sums.emplace_back(0);
+      for (const auto& key : keys) {
+        key_hash_sums.emplace_back(key_hash_sums.back() + Checksum::GetKeyHash(key));
+      }
+    }
   }
 
   static void
@@ -93,6 +155,7 @@ class IndexFixture : public ::testing::Test
     forward = {};
     backward = {};
     random = {};
+    key_hash_sums = {};
     ReleaseTestData(keys);
   }
 
@@ -121,6 +184,10 @@ class IndexFixture : public ::testing::Test
   {
     index_ = std::make_unique<IndexWrapper_t>(keys);
     index_->SetUp();
+    if (trace_smo_) {
+      smo_recorder_.Clear();
+      index_->SetSMOHandler([&](const SMOType type) { smo_recorder_.Record(type); });
+    }
     exec_num_ = rec_num;
     if (pattern == kSequential) {
       target_ids_ = &forward;
@@ -131,6 +198,121 @@ class IndexFixture : public ::testing::Test
     }
   }
 
+  /**
+   * @param pattern An order of target keys.
+   * @param n The number of target keys.
+   * @return Target key IDs. The clustered pattern selects runs of
+   * `kClusterSize` consecutive keys in random order.
+   */
+  static auto
+  GetTargetIDs(  //
+      const AccessPattern pattern,
+      const size_t n)  //
+      -> std::vector<size_t>
+  {
+    std::vector<size_t> ids{};
+    ids.reserve(n);
+    if (pattern == kClustered) {
+      std::vector<size_t> clusters{};
+      for (size_t i = 0; i < kExecNum; i += kClusterSize) {
+        clusters.emplace_back(i);
+      }
+      std::mt19937_64 rand_engine{kRandomSeed};
+      std::shuffle(clusters.begin(), clusters.end(), rand_engine);
+      for (const auto head : clusters) {
+        for (size_t id = head; id < head + kClusterSize && id < kExecNum && ids.size() < n; ++id) {
+          ids.emplace_back(id);
+        }
+      }
+    } else {
+      const auto& src = (pattern == kSequential) ? forward
+                        : (pattern == kReverse)  ? backward
+                                                 : random;
+      ids.assign(src.begin(), src.begin() + n);
+    }
+    return ids;
+  }
+
+  /**
+   * @param gaps A pattern of gaps.
+   * @param is_gap A flag for selecting gap keys instead of present ones.
+   * @return Target key IDs in random order.
+   */
+  static auto
+  GetGapIDs(  //
+      const GapPattern gaps,
+      const bool is_gap)  //
+      -> std::vector<size_t>
+  {
+    std::vector<size_t> ids{};
+    for (const auto id : random) {
+      if (IsGapKey(id, gaps) == is_gap) {
+        ids.emplace_back(id);
+      }
+    }
+    return ids;
+  }
+
+  /**
+   * @brief Load the given keys by write or insert operations.
+   *
+   * @param ids The IDs of target keys.
+   */
+  void
+  Load(  //
+      const std::vector<size_t>& ids)
+  {
+    for (const auto id : ids) {
+      if constexpr (HasWrite<Index, Key, Payload>()) {
+        index_->Write(id);
+      } else {
+        ASSERT_FALSE(index_->Insert(id)) << "[Insert: RC]";
+      }
+    }
+  }
+
+  /**
+   * @brief Load the keys other than gap ones in random order.
+   *
+   * @param gaps A pattern of gaps.
+   */
+  void
+  LoadWithGaps(  //
+      const GapPattern gaps)
+  {
+    std::cout << "  [dbgroup] load keys with gaps...\n";
+    Load(GetGapIDs(gaps, false));
+  }
+
+  /**
+   * @brief Compute the ranges of keys that start with each key.
+   *
+   * Variable-length keys are generated by appending digits and padding to
+   * their parents in depth-first order, and so the keys that start with the
+   * i-th key are exactly the IDs in [i, ends[i]).
+   *
+   * @return The end ID of the prefix range for each key.
+   */
+  static auto
+  GetPrefixEnds()  //
+      -> std::vector<size_t>
+  {
+    std::vector<size_t> ends(kExecNum, kExecNum);
+    if constexpr (IsVarLenData<Key>()) {
+      std::vector<size_t> stack{};
+      for (size_t i = 0; i < kExecNum; ++i) {
+        while (!stack.empty()) {
+          const auto& prefix = keys[stack.back()];
+          if (std::strncmp(keys[i], prefix, GetLength(prefix) - 1) == 0) break;
+          ends[stack.back()] = i;
+          stack.pop_back();
+        }
+        stack.emplace_back(i);
+      }
+    }
+    return ends;
+  }
+
   /*##########################################################################*
    * Functions for verification
    *##########################################################################*/
@@ -157,6 +339,45 @@ class IndexFixture : public ::testing::Test
     }
   }
 
+  /**
+   * @brief Verify a full scan by an order-independent checksum.
+   *
+   * This function does not report failures, and so callers should compare each
+   * record again to locate wrong ones if it returns false.
+   *
+   * @param iter An iterator of a full scan.
+   * @param rec_num The expected number of records (i.e., IDs in [0, rec_num)).
+   * @param expected_val The expected payload of all the records.
+   * @param reverse A flag for scanning in descending order.
+   * @retval true if the scan returns the expected records in order.
+   * @retval false otherwise.
+   */
+  template <class Iter>
+  auto
+  MatchScanChecksum(  //
+      Iter&& iter,
+      const size_t rec_num,
+      const uint32_t expected_val,
+      const bool reverse)  //
+      -> bool
+  {
+    if constexpr (!kDisableScanVerifyTest) {
+      iter.PrepareVerifier();
+    }
+
+    Checksum checksum{reverse};
+    for (; iter; ++iter) {
+      const auto& [key, payload] = *iter;
+      if (!checksum.Add(key, payload)) return false;
+    }
+    if constexpr (!kDisableScanVerifyTest) {
+      if (!iter.VerifySnapshot() || !iter.VerifyNoPhantom()) return false;
+    }
+
+    const auto expected = key_hash_sums[rec_num] + rec_num * Checksum::GetPayloadHash(expected_val);
+    return checksum.GetRecordNum() == rec_num && checksum.GetSum() == expected;
+  }
+
   void
   VerifyScanForward(  //
       [[maybe_unused]] const size_t rec_num,
@@ -166,6 +387,12 @@ class IndexFixture : public ::testing::Test
     if (!HasScan<Index, Key, Payload>() || HasFailure()) return;
 
     std::cout << "  [dbgroup] scan forward...\n";
+    if constexpr (kVerifyScanWithChecksum) {
+      if (expect_success) {
+        if (MatchScanChecksum(index_->Scan(), rec_num, expected_val, !kReverseScan)) return;
+        std::cout << "  [dbgroup] checksum mismatch, so compare each record...\n";
+      }
+    }
     auto&& iter = index_->Scan();
     if (expect_success) {
       if constexpr (!kDisableScanVerifyTest) {
@@ -197,6 +424,12 @@ class IndexFixture : public ::testing::Test
     if (!HasScanBackward<Index, Key, Payload>() || HasFailure()) return;
 
     std::cout << "  [dbgroup] scan backward...\n";
+    if constexpr (kVerifyScanWithChecksum) {
+      if (expect_success) {
+        if (MatchScanChecksum(index_->ScanBackward(), rec_num, expected_val, kReverseScan)) return;
+        std::cout << "  [dbgroup] checksum mismatch, so compare each record...\n";
+      }
+    }
     auto&& iter = index_->ScanBackward();
     if (expect_success) {
       if constexpr (!kDisableScanVerifyTest) {
@@ -225,6 +458,20 @@ class IndexFixture : public ::testing::Test
     if (!HasWrite<Index, Key, Payload>() || HasFailure()) return;
 
     std::cout << "  [dbgroup] write...\n";
+    if (trace_smo_) {
+      LatencyRecorder latency{};
+      latency.Reserve(0, exec_num_);
+      for (size_t i = 0; i < exec_num_; ++i) {
+        const auto id = target_ids_->at(i);
+        const auto begin = GetTimestamp();
+        index_->Write(id);
+        latency.Record(0, begin, GetTimestamp());
+        if (HasFailure()) return;
+      }
+      smo_recorder_.Report(latency);
+      return;
+    }
+
     for (size_t i = 0; i < exec_num_; ++i) {
       const auto id = target_ids_->at(i);
       index_->Write(id);
@@ -298,6 +545,41 @@ class IndexFixture : public ::testing::Test
     }
   }
 
+  /**
+   * @brief Swap the payload of each key only if it is expected.
+   *
+   * A swap with an unexpected payload must fail without modifying the record,
+   * and then a swap with the expected one must increment the payload.
+   *
+   * @param expect_success A flag for expecting that the target keys exist.
+   * @param expected_val The current payload of the target keys.
+   */
+  void
+  VerifyCompareAndSwap(  //
+      const bool expect_success,
+      const uint32_t expected_val)
+  {
+    if (!HasCompareAndSwap<Index, Key, Payload>() || HasFailure()) return;
+
+    std::cout << "  [dbgroup] compare and swap...\n";
+    for (size_t i = 0; i < exec_num_; ++i) {
+      const auto id = target_ids_->at(i);
+      const auto& stale = index_->CompareAndSwap(id, expected_val + 1, expected_val + 2);
+      if (HasFailure()) return;
+      if (!expect_success) {
+        ASSERT_FALSE(stale) << "[CompareAndSwap: RC]";
+        continue;
+      }
+      ASSERT_TRUE(stale) << "[CompareAndSwap: RC]";
+      ASSERT_EQ(stale.value(), expected_val) << "[CompareAndSwap: unexpected payload]";
+
+      const auto& ret = index_->CompareAndSwap(id, expected_val, expected_val + 1);
+      if (HasFailure()) return;
+      ASSERT_TRUE(ret) << "[CompareAndSwap: RC]";
+      ASSERT_EQ(ret.value(), expected_val) << "[CompareAndSwap: returned value]";
+    }
+  }
+
   void
   VerifyDelete(  //
       const bool expect_success,
@@ -320,6 +602,109 @@ class IndexFixture : public ::testing::Test
     }
   }
 
+  void
+  CollectShrinkStats(  //
+      const size_t heap_base,
+      const std::vector<bool>& is_deleted,
+      ShrinkStats& stats)
+  {
+    stats.node_num = index_->GetNodeCount();
+    stats.fill_factor = index_->GetFillFactor();
+    stats.memory = GetIndexMemoryUsage<Index>(*index_, heap_base);
+
+    stats.rec_num = 0;
+    if constexpr (HasRead<Index, Key, Payload>()) {
+      const auto begin = GetTimestamp();
+      for (const auto id : random) {
+        if (is_deleted[id]) continue;
+        const auto& ret = index_->Read(id);
+        ASSERT_TRUE(ret) << "[Read: RC]";
+        ++stats.rec_num;
+      }
+      const auto sec = static_cast<double>(GetTimestamp() - begin) / 1e9;
+      stats.read_tput = static_cast<double>(stats.rec_num) / sec;
+
+      for (size_t id = 0; id < kExecNum; ++id) {
+        if (!is_deleted[id]) continue;
+        ASSERT_FALSE(index_->Read(id)) << "[Read: deleted records]";
+      }
+    }
+
+    if constexpr (HasScan<Index, Key, Payload>()) {
+      size_t cnt = 0;
+      const auto begin = GetTimestamp();
+      for (auto&& iter = index_->Scan(); iter; ++iter) {
+        ++cnt;
+      }
+      const auto sec = static_cast<double>(GetTimestamp() - begin) / 1e9;
+      stats.scan_tput = static_cast<double>(cnt) / sec;
+      if (stats.rec_num == 0) {
+        stats.rec_num = cnt;
+      }
+      ASSERT_EQ(cnt, stats.rec_num) << "[Scan: # of records]";
+    }
+  }
+
+  auto
+  MeasureReadLatency(  //
+      const std::vector<size_t>& ids,
+      const size_t expected_val)  //
+      -> ReadLatency
+  {
+    std::vector<uint64_t> lats{};
+    lats.reserve(ids.size());
+    uint64_t total = 0;
+    for (const auto id : ids) {
+      const auto begin = GetTimestamp();
+      const auto& ret = index_->Read(id);
+      lats.emplace_back(GetTimestamp() - begin);
+      total += lats.back();
+      EXPECT_TRUE(ret) << "[Read: RC]";
+      if (!ret) break;
+      EXPECT_EQ(static_cast<size_t>(ret.value()), expected_val) << "[Read: merged value]";
+      if (HasFailure()) break;
+    }
+    return {total / std::max<size_t>(lats.size(), 1), GetQuantile(lats, 0.5),
+            GetQuantile(lats, 0.99)};
+  }
+
+  static void
+  ReportShrinkStats(  //
+      const ShrinkStats& before,
+      const ShrinkStats& after)
+  {
+    auto print_row = [](const char* label, const ShrinkStats& stats) {
+      std::cout << "  [dbgroup] " << std::left << std::setw(7) << label << std::right
+                << std::setw(10) << stats.rec_num;
+      if (stats.node_num) {
+        std::cout << std::setw(10) << *stats.node_num;
+      } else {
+        std::cout << std::setw(10) << "n/a";
+      }
+      if (stats.fill_factor) {
+        std::cout << std::setw(13) << std::fixed << std::setprecision(3) << *stats.fill_factor;
+      } else {
+        std::cout << std::setw(13) << "n/a";
+      }
+      std::cout << std::setw(13) << stats.memory << std::fixed << std::setprecision(0)
+                << std::setw(14) << stats.read_tput << std::setw(16) << stats.scan_tput
+                << std::defaultfloat << '\n';
+    };
+
+    std::cout << "  [dbgroup] " << std::setw(17) << "records" << std::setw(10) << "nodes"
+              << std::setw(13) << "fill factor" << std::setw(13) << "memory [B]" << std::setw(14)
+              << "read [ops/s]" << std::setw(16) << "scan [recs/s]" << '\n';
+    print_row("before", before);
+    print_row("after", after);
+    if (before.memory > 0) {
+      const auto kept = std::min(before.memory, after.memory);
+      const auto reclaimed = static_cast<double>(before.memory - kept);
+      std::cout << "  [dbgroup] reclaimed memory: " << std::fixed << std::setprecision(1)
+                << reclaimed * 100 / static_cast<double>(before.memory) << "%" << std::defaultfloat
+                << '\n';
+    }
+  }
+
   /*##########################################################################*
    * Functions for test definitions
    *##########################################################################*/
@@ -331,6 +716,18 @@ class IndexFixture : public ::testing::Test
     VerifyRead(kExpectFailed, 0);
   }
 
+  void
+  VerifyConstructWithSMOs(  //
+      const size_t rec_num)
+  {
+    trace_smo_ = HasSMOHandler<Index>();
+    VerifyWriteWith(!kWriteTwice, !kWithDelete, kSequential, rec_num);
+    if (!trace_smo_ || HasFailure()) return;
+
+    const auto& counts = smo_recorder_.GetCounts();
+    EXPECT_GT(std::accumulate(counts.begin(), counts.end(), 0UL), 0) << "[SMOs: # of reports]";
+  }
+
   void
   VerifyScanForwardWith(  //
       const bool closed)
@@ -399,6 +796,146 @@ class IndexFixture : public ::testing::Test
     ASSERT_FALSE(iter) << "[ScanBackward: iterator]";
   }
 
+  /**
+   * @brief Load all the keys or the keys other than gap ones for prefix scans.
+   *
+   * Indexes without write operations are bulkloaded instead.
+   *
+   * @param gaps An optional pattern of gaps.
+   */
+  void
+  LoadForScanPrefix(  //
+      const std::optional<GapPattern>& gaps)
+  {
+    Preprocess();
+
+    if constexpr (HasWrite<Index, Key, Payload>() || HasInsert<Index, Key, Payload>()) {
+      if (gaps) {
+        LoadWithGaps(*gaps);
+        return;
+      }
+
+      std::cout << "  [dbgroup] initialization...\n";
+      Load(forward);
+      if (HasFailure()) return;
+    } else {
+      std::cout << "  [dbgroup] bulkload...\n";
+      index_->Bulkload(gaps);
+    }
+  }
+
+  /**
+   * @brief Scan the records with each key as a prefix.
+   *
+   * @param with_gaps A flag for leaving keys with odd IDs unloaded.
+   */
+  void
+  VerifyScanPrefixWith(  //
+      const bool with_gaps)
+  {
+    if (!IsVarLenData<Key>()                                                       //
+        || (!HasScanPrefix<Index, Key>() && !HasScan<Index, Key, Payload>())       //
+        || (!HasWrite<Index, Key, Payload>() && !HasInsert<Index, Key, Payload>()  //
+            && !HasBulkload<Index, Key, Payload>()))                               //
+    {
+      GTEST_SKIP();
+    }
+
+    LoadForScanPrefix(with_gaps ? std::optional{kOddGaps} : std::nullopt);
+    if (HasFailure()) return;
+    const auto step = with_gaps ? 2UL : 1UL;
+
+    std::cout << "  [dbgroup] scan with prefixes...\n";
+    const auto ends = GetPrefixEnds();
+    for (size_t i = 0; !HasFailure() && i < kExecNum; ++i) {
+      auto&& iter = index_->ScanPrefix(i);
+      auto id = (i + step - 1) / step * step;
+      for (; !HasFailure() && iter && id < ends[i]; ++iter, id += step) {
+        const auto& [key, payload] = *iter;
+        ASSERT_TRUE(Equal<Comp>(key, keys[id])) << "[ScanPrefix: key]";
+        ASSERT_EQ(payload, 1) << "[ScanPrefix: payload]";
+      }
+      ASSERT_GE(id, ends[i]) << "[ScanPrefix: # of records]";
+      ASSERT_FALSE(iter) << "[ScanPrefix: iterator]";
+    }
+  }
+
+  /**
+   * @brief Measure prefix scans for each order of magnitude of selectivity.
+   *
+   * Loaded keys are grouped by the number of records that start with them
+   * (1-9, 10-99, 100-999, ...), and up to `kMaxRangeNum` prefixes in each group
+   * are scanned repeatedly until about `kExecNum` records are read.
+   */
+  void
+  MeasureScanPrefix()
+  {
+    if (!IsVarLenData<Key>()                                                       //
+        || (!HasScanPrefix<Index, Key>() && !HasScan<Index, Key, Payload>())       //
+        || (!HasWrite<Index, Key, Payload>() && !HasInsert<Index, Key, Payload>()  //
+            && !HasBulkload<Index, Key, Payload>()))                               //
+    {
+      GTEST_SKIP();
+    }
+
+    LoadForScanPrefix(std::nullopt);
+    if (HasFailure()) return;
+
+    const auto ends = GetPrefixEnds();
+    std::vector<std::vector<size_t>> groups{};
+    for (size_t i = 0; i < kExecNum; ++i) {
+      size_t g = 0;
+      for (auto n = ends[i] - i; n >= 10; n /= 10) {
+        ++g;
+      }
+      if (groups.size() <= g) {
+        groups.resize(g + 1);
+      }
+      groups[g].emplace_back(i);
+    }
+
+    std::cout << "  [dbgroup] prefix scan: "
+              << (HasScanPrefix<Index, Key>() ? "native" : "range scan fallback") << '\n';
+    std::cout << "  [dbgroup] " << std::setw(12) << "records" << std::setw(10) << "prefixes"
+              << std::setw(14) << "avg records" << std::setw(17) << "selectivity [%]"
+              << std::setw(13) << "scans/s" << std::setw(15) << "records/s" << '\n';
+    for (size_t g = 0, lo = 1; g < groups.size(); ++g, lo *= 10) {
+      if (groups[g].empty()) continue;
+
+      // select prefixes evenly from the group
+      const auto& group = groups[g];
+      const auto prefix_num = std::min(kMaxRangeNum, group.size());
+      std::vector<size_t> prefixes{};
+      size_t rec_num = 0;
+      for (size_t j = 0; j < prefix_num; ++j) {
+        const auto id = group[j * group.size() / prefix_num];
+        prefixes.emplace_back(id);
+        rec_num += ends[id] - id;
+      }
+      const auto repeat = std::max(1UL, kExecNum / rec_num);
+
+      size_t cnt = 0;
+      const auto begin = GetTimestamp();
+      for (size_t r = 0; r < repeat; ++r) {
+        for (const auto id : prefixes) {
+          for (auto&& iter = index_->ScanPrefix(id); iter; ++iter) {
+            ++cnt;
+          }
+        }
+      }
+      const auto sec = static_cast<double>(GetTimestamp() - begin) / 1e9;
+      ASSERT_EQ(cnt, rec_num * repeat) << "[ScanPrefix: # of records]";
+
+      const auto avg = static_cast<double>(rec_num) / prefix_num;
+      const auto label = std::to_string(lo) + "-" + std::to_string(lo * 10 - 1);
+      std::cout << "  [dbgroup] " << std::setw(12) << label << std::setw(10) << prefix_num
+                << std::fixed << std::setprecision(1) << std::setw(14) << avg
+                << std::setprecision(4) << std::setw(17) << 100.0 * avg / kExecNum
+                << std::setprecision(0) << std::setw(13) << prefix_num * repeat / sec
+                << std::setw(15) << cnt / sec << std::defaultfloat << '\n';
+    }
+  }
+
   void
   VerifyWriteWith(  //
       const bool write_twice,
@@ -536,6 +1073,42 @@ class IndexFixture : public ::testing::Test
     VerifyScanBackward(kExecNum, expect_success, expected_val);
   }
 
+  void
+  VerifyCompareAndSwapWith(  //
+      const bool with_write,
+      const bool with_delete,
+      const AccessPattern pattern)
+  {
+    if (!HasCompareAndSwap<Index, Key, Payload>()               //
+        || (with_write && !HasWrite<Index, Key, Payload>())     //
+        || (with_delete && !HasDelete<Index, Key, Payload>()))  //
+    {
+      GTEST_SKIP();
+    }
+
+    const auto expect_success = with_write && !with_delete;
+    Preprocess(pattern);
+
+    uint32_t expected_val = 0;
+    if (with_write) {
+      VerifyWrite();
+      expected_val = 1;
+    }
+
+    if (with_delete) {
+      VerifyDelete(with_write, expected_val);
+    }
+
+    VerifyCompareAndSwap(expect_success, expected_val);
+    if (expect_success) {
+      expected_val += 1;
+    }
+
+    VerifyRead(expect_success, expected_val);
+    VerifyScanForward(kExecNum, expect_success, expected_val);
+    VerifyScanBackward(kExecNum, expect_success, expected_val);
+  }
+
   void
   VerifyDeleteWith(  //
       const bool with_write,
@@ -568,6 +1141,150 @@ class IndexFixture : public ::testing::Test
     VerifyScanBackward(kExecNum, kExpectFailed, expected_val);
   }
 
+  /**
+   * @brief Delete a range of loaded keys at once.
+   *
+   * The remaining keys must be readable and scannable, and the deleted range
+   * must become empty and accept inserted keys again.
+   *
+   * @param b_id An optional ID of a begin key.
+   * @param e_id An optional ID of an end key.
+   * @param closed A flag for including the keys at both ends.
+   */
+  void
+  VerifyDeleteRangeWith(  //
+      const std::optional<size_t>& b_id,
+      const std::optional<size_t>& e_id,
+      const bool closed)
+  {
+    if (!HasDeleteRange<Index, Key>()                                                //
+        || (!HasWrite<Index, Key, Payload>() && !HasInsert<Index, Key, Payload>()))  //
+    {
+      GTEST_SKIP();
+    }
+
+    Preprocess();
+
+    std::cout << "  [dbgroup] initialization...\n";
+    Load(forward);
+    if (HasFailure()) return;
+
+    auto in_range = [&](const size_t id) {
+      if (b_id && (id < *b_id || (!closed && id == *b_id))) return false;
+      if (e_id && (id > *e_id || (!closed && id == *e_id))) return false;
+      return true;
+    };
+    size_t del_num = 0;
+    for (size_t id = 0; id < kExecNum; ++id) {
+      del_num += in_range(id) ? 1 : 0;
+    }
+
+    std::cout << "  [dbgroup] delete range...\n";
+    const auto ret = index_->DeleteRange(b_id, closed, e_id, closed);
+    ASSERT_EQ(ret, del_num) << "[DeleteRange: # of records]";
+    ASSERT_EQ(index_->DeleteRange(b_id, closed, e_id, closed), 0) << "[DeleteRange: deleted range]";
+
+    if constexpr (HasRead<Index, Key, Payload>()) {
+      for (size_t id = 0; id < kExecNum; ++id) {
+        const auto& ret = index_->Read(id);
+        if (in_range(id)) {
+          ASSERT_FALSE(ret) << "[Read: deleted records]";
+        } else {
+          ASSERT_TRUE(ret) << "[Read: RC]";
+          ASSERT_EQ(ret.value(), 1) << "[Read: returned value]";
+        }
+      }
+    }
+
+    if constexpr (HasScan<Index, Key, Payload>()) {
+      size_t id = 0;
+      for (auto&& iter = index_->Scan(); iter; ++iter, ++id) {
+        while (id < kExecNum && in_range(id)) {
+          ++id;
+        }
+        ASSERT_LT(id, kExecNum) << "[Scan: deleted records]";
+        const auto& [key, payload] = *iter;
+        ASSERT_TRUE(Equal<Comp>(key, keys[id])) << "[Scan: key]";
+      }
+      while (id < kExecNum && in_range(id)) {
+        ++id;
+      }
+      ASSERT_EQ(id, kExecNum) << "[Scan: # of records]";
+
+      size_t cnt = 0;
+      for (auto&& iter = index_->Scan(b_id, closed, e_id, closed); iter; ++iter) {
+        ++cnt;
+      }
+      ASSERT_EQ(cnt, 0) << "[Scan: deleted range]";
+    }
+
+    if constexpr (HasInsert<Index, Key, Payload>()) {
+      // deleted keys can be inserted again
+      for (size_t id = 0; id < kExecNum; ++id) {
+        if (!in_range(id)) continue;
+        ASSERT_FALSE(index_->Insert(id)) << "[Insert: RC]";
+      }
+    }
+  }
+
+  /**
+   * @brief Compare range deletes with per-key deletes for each range size.
+   *
+   * For each size in `kRangeSizes`, up to `kMaxRangeNum` disjoint ranges spread
+   * over loaded keys are deleted by `DeleteRange` and by `Delete` for each key
+   * in fresh indexes.
+   */
+  void
+  MeasureRangeDelete()
+  {
+    if (!HasDeleteRange<Index, Key>()                                                //
+        || !HasDelete<Index, Key, Payload>()                                         //
+        || (!HasWrite<Index, Key, Payload>() && !HasInsert<Index, Key, Payload>()))  //
+    {
+      GTEST_SKIP();
+    }
+
+    auto load = [&] {
+      Preprocess();
+      Load(forward);
+    };
+
+    std::cout << "  [dbgroup] " << std::setw(11) << "range size" << std::setw(8) << "ranges"
+              << std::setw(17) << "range [us/op]" << std::setw(19) << "per-key [us/op]"
+              << std::setw(10) << "speedup" << '\n';
+    for (const auto size : kRangeSizes) {
+      if (2 * size > kExecNum) break;
+      const auto range_num = std::min(kMaxRangeNum, kExecNum / (2 * size));
+      const auto stride = kExecNum / range_num;
+
+      load();
+      if (HasFailure()) return;
+      auto begin = GetTimestamp();
+      for (size_t r = 0; r < range_num; ++r) {
+        const auto head = r * stride;
+        const auto ret = index_->DeleteRange(head, kClosed, head + size - 1, kClosed);
+        ASSERT_EQ(ret, size) << "[DeleteRange: # of records]";
+      }
+      const auto range_us = static_cast<double>(GetTimestamp() - begin) / 1e3 / range_num;
+
+      load();
+      if (HasFailure()) return;
+      begin = GetTimestamp();
+      for (size_t r = 0; r < range_num; ++r) {
+        const auto head = r * stride;
+        for (size_t id = head; id < head + size; ++id) {
+          ASSERT_TRUE(index_->Delete(id)) << "[Delete: RC]";
+        }
+      }
+      const auto per_key_us = static_cast<double>(GetTimestamp() - begin) / 1e3 / range_num;
+
+      std::cout << "  [dbgroup] " << std::setw(11) << size << std::setw(8) << range_num
+                << std::fixed << std::setprecision(2) << std::setw(17) << range_us << std::setw(19)
+                << per_key_us << std::setw(10) << per_key_us / range_us << std::defaultfloat
+                << '\n';
+    }
+  }
+
   void
   VerifyBulkloadWith(  //
       const WriteOperation write_ops,
@@ -619,6 +1336,383 @@ class IndexFixture : public ::testing::Test
     VerifyScanBackward(kExecNum, expect_success, expected_val);
   }
 
+  void
+  MeasureShrinkWith(  //
+      const AccessPattern pattern,
+      const size_t delete_percent)
+  {
+    if (!HasDelete<Index, Key, Payload>()                                            //
+        || (!HasWrite<Index, Key, Payload>() && !HasInsert<Index, Key, Payload>()))  //
+    {
+      GTEST_SKIP();
+    }
+
+    const auto& targets = GetTargetIDs(pattern, kExecNum * delete_percent / 100);
+    std::vector<bool> is_deleted(kExecNum, false);
+    ShrinkStats before{};
+    ShrinkStats after{};
+
+    const auto heap_base = GetHeapUsage();
+    Preprocess(kRandom);
+    std::cout << "  [dbgroup] initialization...\n";
+    Load(random);
+    if (HasFailure()) return;
+    CollectShrinkStats(heap_base, is_deleted, before);
+    if (HasFailure()) return;
+
+    std::cout << "  [dbgroup] delete " << delete_percent << "% of keys...\n";
+    for (const auto id : targets) {
+      const auto& ret = index_->Delete(id);
+      if (HasFailure()) return;
+      ASSERT_TRUE(ret) << "[Delete: RC]";
+      ASSERT_EQ(ret.value(), 1) << "[Delete: returned value]";
+      is_deleted[id] = true;
+    }
+    CollectShrinkStats(heap_base, is_deleted, after);
+    if (HasFailure()) return;
+
+    ReportShrinkStats(before, after);
+  }
+
+  /**
+   * @brief Measure the throughput of bulkloading a lazily produced input.
+   *
+   * The input consists of `kBulkloadNum` records, which may exceed
+   * `kExecNum` if keys have fixed lengths. The input is materialized only if
+   * the index does not accept `BulkloadInput`.
+   */
+  void
+  MeasureBulkloadThroughput()
+  {
+    constexpr auto kStreamed = HasBulkloadInput<Index, Key, Payload>();
+
+    if (!HasBulkload<Index, Key, Payload>()) {
+      GTEST_SKIP();
+    }
+
+    const BulkloadInput<Key, Payload> input{keys, kBulkloadNum};
+    const auto rec_num = input.size();
+    const auto heap_base = GetHeapUsage();
+    Preprocess();
+
+    std::cout << "  [dbgroup] bulkload " << rec_num << " records ("
+              << (kStreamed ? "streamed" : "materialized") << ")...\n";
+    const auto begin = GetTimestamp();
+    index_->Bulkload(input);
+    const auto sec = static_cast<double>(GetTimestamp() - begin) / 1e9;
+    if (HasFailure()) return;
+
+    const auto memory = GetIndexMemoryUsage<Index>(*index_, heap_base);
+    std::cout << "  [dbgroup] " << static_cast<size_t>(static_cast<double>(rec_num) / sec)
+              << " records/s (" << sec * 1000 << " ms), " << memory / std::max<size_t>(rec_num, 1)
+              << " bytes/record\n";
+
+    if constexpr (HasScan<Index, Key, Payload>()) {
+      size_t cnt = 0;
+      for (auto&& iter = index_->Scan(); iter && !HasFailure(); ++iter, ++cnt) {
+        const auto& [key, payload] = *iter;
+        ASSERT_EQ(payload, 1) << "[Scan: payload]";
+      }
+      ASSERT_EQ(cnt, rec_num) << "[Scan: # of records]";
+    } else {
+      exec_num_ = std::min(rec_num, kExecNum);
+      VerifyRead(kExpectSuccess, 1);
+    }
+  }
+
+  /**
+   * @brief Measure how bulkloading scales with threads and input sizes.
+   *
+   * The input sizes grow by four times up to `kBulkloadNum`, and the number of
+   * threads doubles up to `kThreadNum`. If the input is not sorted, it is
+   * shuffled in advance and sorted in parallel before bulkloading. The sorting
+   * and bulkloading are timed separately, and each of them reports its own
+   * speedup over a single thread.
+   *
+   * @param presorted A flag for giving sorted input.
+   */
+  void
+  MeasureBulkloadScalingWith(  //
+      const bool presorted)
+  {
+    using Entry = typename BulkloadInput<Key, Payload>::Entry;
+
+    if (!HasBulkload<Index, Key, Payload>()) {
+      GTEST_SKIP();
+    }
+
+    std::vector<size_t> thread_nums{};
+    for (size_t n = 1; n < kThreadNum; n *= 2) {
+      thread_nums.emplace_back(n);
+    }
+    thread_nums.emplace_back(kThreadNum);
+
+    std::cout << "  [dbgroup] " << std::setw(10) << "records" << std::setw(9) << "threads"
+              << std::setw(11) << "sort [ms]" << std::setw(9) << "speedup" << std::setw(12)
+              << "build [ms]" << std::setw(9) << "speedup" << std::setw(10) << "nodes"
+              << std::setw(13) << "fill factor" << std::setw(13) << "memory [B]" << '\n';
+
+    size_t prev_size = 0;
+    for (size_t i = kBulkloadSizeNum; i > 0 && !HasFailure(); --i) {
+      const BulkloadInput<Key, Payload> input{keys, kBulkloadNum >> (2 * (i - 1))};
+      if (input.size() == prev_size) continue;  // variable-length keys are limited
+      prev_size = input.size();
+
+      uint64_t base_sort = 0;
+      uint64_t base_build = 0;
+      for (const auto t_num : thread_nums) {
+        if (index_) {
+          index_->TearDown();
+          index_ = nullptr;
+        }
+
+        std::vector<Entry> entries{};
+        if (!presorted) {
+          entries.assign(input.begin(), input.end());
+          std::mt19937_64 rand_engine{kRandomSeed};
+          std::shuffle(entries.begin(), entries.end(), rand_engine);
+        }
+        const auto heap_base = GetHeapUsage();
+        Preprocess();
+
+        const auto begin = GetTimestamp();
+        if (!presorted) {
+          ParallelSort(
+              entries,
+              [](const Entry& lhs, const Entry& rhs) {
+                return Comp{}(std::get<0>(lhs), std::get<0>(rhs));
+              },
+              t_num);
+        }
+        const auto mid = GetTimestamp();
+        if (presorted) {
+          index_->Bulkload(input, t_num);
+        } else {
+          index_->Bulkload(entries, t_num);
+        }
+        const auto end = GetTimestamp();
+        if (HasFailure()) return;
+
+        if (t_num == 1) {
+          base_sort = mid - begin;
+          base_build = end - mid;
+        }
+        const auto memory = GetIndexMemoryUsage<Index>(*index_, heap_base);
+        const auto node_num = index_->GetNodeCount();
+        const auto fill_factor = index_->GetFillFactor();
+
+        std::cout << "  [dbgroup] " << std::setw(10) << input.size() << std::setw(9) << t_num
+                  << std::fixed << std::setprecision(1) << std::setw(11);
+        if (presorted) {
+          std::cout << "-" << std::setw(9) << "-";
+        } else {
+          const auto sort_time = static_cast<double>(mid - begin);
+          std::cout << sort_time / 1e6 << std::setprecision(2) << std::setw(9)
+                    << static_cast<double>(base_sort) / sort_time << std::setprecision(1);
+        }
+        const auto speedup = static_cast<double>(base_build) / static_cast<double>(end - mid);
+        std::cout << std::setw(12) << static_cast<double>(end - mid) / 1e6 << std::setprecision(2)
+                  << std::setw(9) << speedup;
+        if (node_num) {
+          std::cout << std::setw(10) << *node_num;
+        } else {
+          std::cout << std::setw(10) << "n/a";
+        }
+        if (fill_factor) {
+          std::cout << std::setw(13) << std::setprecision(3) << *fill_factor;
+        } else {
+          std::cout << std::setw(13) << "n/a";
+        }
+        std::cout << std::setw(13) << memory << std::defaultfloat << '\n';
+
+        if constexpr (HasScan<Index, Key, Payload>()) {
+          size_t cnt = 0;
+          for (auto&& iter = index_->Scan(); iter; ++iter) {
+            ++cnt;
+          }
+          ASSERT_EQ(cnt, input.size()) << "[Scan: # of records]";
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Read present and absent keys that interleave with each other.
+   *
+   * @param gaps A pattern of absent keys.
+   * @param miss_percent The percentage of lookups for absent keys.
+   */
+  void
+  VerifyReadWithMissesWith(  //
+      const GapPattern gaps,
+      const size_t miss_percent)
+  {
+    if (!HasRead<Index, Key, Payload>()                                              //
+        || (!HasWrite<Index, Key, Payload>() && !HasInsert<Index, Key, Payload>()))  //
+    {
+      GTEST_SKIP();
+    }
+
+    Preprocess(kRandom);
+    LoadWithGaps(gaps);
+    if (HasFailure()) return;
+
+    const auto& present = GetGapIDs(gaps, false);
+    const auto& absent = GetGapIDs(gaps, true);
+    std::mt19937_64 rand_engine{kRandomSeed};
+    size_t hit_num = 0;
+    size_t miss_num = 0;
+    uint64_t hit_time = 0;
+    uint64_t miss_time = 0;
+
+    std::cout << "  [dbgroup] read with " << miss_percent << "% misses...\n";
+    for (size_t i = 0; i < kExecNum; ++i) {
+      const auto is_miss = rand_engine() % 100 < miss_percent;
+      const auto id = is_miss ? absent[miss_num % absent.size()]  //
+                              : present[hit_num % present.size()];
+      const auto begin = GetTimestamp();
+      const auto& ret = index_->Read(id);
+      const auto elapsed = GetTimestamp() - begin;
+      if (HasFailure()) return;
+
+      if (is_miss) {
+        ASSERT_FALSE(ret) << "[Read: absent key]";
+        miss_time += elapsed;
+        ++miss_num;
+      } else {
+        ASSERT_TRUE(ret) << "[Read: RC]";
+        ASSERT_EQ(ret.value(), 1) << "[Read: returned value]";
+        hit_time += elapsed;
+        ++hit_num;
+      }
+    }
+
+    std::cout << "  [dbgroup] hits: " << hit_num << " (" << hit_time / std::max<size_t>(hit_num, 1)
+              << " ns/op), misses: " << miss_num << " ("
+              << miss_time / std::max<size_t>(miss_num, 1) << " ns/op)\n";
+  }
+
+  /**
+   * @brief Insert keys into the gaps between existing keys.
+   *
+   * @param gaps A pattern of gaps.
+   * @param pattern An order of inserting gap keys.
+   */
+  void
+  VerifyGapInsertWith(  //
+      const GapPattern gaps,
+      const AccessPattern pattern)
+  {
+    if (!HasWrite<Index, Key, Payload>() && !HasInsert<Index, Key, Payload>()) {
+      GTEST_SKIP();
+    }
+
+    Preprocess(pattern);
+    LoadWithGaps(gaps);
+    if (HasFailure()) return;
+
+    std::cout << "  [dbgroup] fill gaps...\n";
+    size_t cnt = 0;
+    const auto begin = GetTimestamp();
+    for (const auto id : *target_ids_) {
+      if (!IsGapKey(id, gaps)) continue;
+      if constexpr (HasInsert<Index, Key, Payload>()) {
+        ASSERT_FALSE(index_->Insert(id)) << "[Insert: RC]";
+      } else {
+        index_->Write(id);
+      }
+      if (HasFailure()) return;
+      ++cnt;
+    }
+    const auto sec = static_cast<double>(GetTimestamp() - begin) / 1e9;
+    std::cout << "  [dbgroup] " << cnt << " gap keys: "
+              << static_cast<size_t>(static_cast<double>(cnt) / sec) << " ops/s\n";
+
+    VerifyRead(kExpectSuccess, 1);
+    VerifyScanForward(kExecNum, kExpectSuccess, 1);
+    VerifyScanBackward(kExecNum, kExpectSuccess, 1);
+  }
+
+  /**
+   * @brief Measure read latency over records with growing merge depths.
+   *
+   * For each merge depth K (doubling up to `kMaxMergeDepth`), this function
+   * loads keys into a new index and merges a delta into each record K times. It
+   * reports read latency, memory per key, and the cost of `Consolidate()` with
+   * read latency after consolidation if the index supports it.
+   */
+  void
+  MeasureMergeDepth()
+  {
+    constexpr size_t kRecNum = kRecNumWithInternalSMOs;
+    constexpr auto kCanMerge = HasWrite<Index, Key, Payload>()      //
+                               || HasUpsert<Index, Key, Payload>()  //
+                               || HasUpdate<Index, Key, Payload>();
+
+    if (kDisableRecordMerging || !kCanMerge                                          //
+        || !HasRead<Index, Key, Payload>()                                           //
+        || (!HasWrite<Index, Key, Payload>() && !HasInsert<Index, Key, Payload>()))  //
+    {
+      GTEST_SKIP();
+    }
+
+    const auto& ids = GetTargetIDs(kRandom, kRecNum);
+    auto merge = [&](const size_t id) {
+      if constexpr (HasWrite<Index, Key, Payload>()) {
+        index_->Write(id);
+      } else if constexpr (HasUpsert<Index, Key, Payload>()) {
+        index_->Upsert(id);
+      } else {
+        EXPECT_TRUE(index_->Update(id)) << "[Update: RC]";
+      }
+    };
+
+    std::cout << "  [dbgroup] " << std::setw(5) << "K" << std::setw(10) << "avg [ns]"
+              << std::setw(10) << "p50 [ns]" << std::setw(10) << "p99 [ns]" << std::setw(13)
+              << "mem/key [B]";
+    if constexpr (HasConsolidate<Index>()) {
+      std::cout << std::setw(18) << "consolidate [ms]" << std::setw(16) << "avg after [ns]";
+    }
+    std::cout << '\n';
+
+    for (size_t depth = 1; depth <= kMaxMergeDepth && !HasFailure(); depth *= 2) {
+      if (index_) {
+        index_->TearDown();
+        index_ = nullptr;
+      }
+      const auto heap_base = GetHeapUsage();
+      Preprocess(kRandom, kRecNum);
+      Load(ids);
+      if (HasFailure()) return;
+
+      // interleave merges over keys as counters are incremented in practice
+      for (size_t k = 0; k < depth && !HasFailure(); ++k) {
+        for (const auto id : ids) {
+          merge(id);
+        }
+      }
+      if (HasFailure()) return;
+
+      const auto memory = GetIndexMemoryUsage<Index>(*index_, heap_base);
+      const auto lat = MeasureReadLatency(ids, depth + 1);
+      if (HasFailure()) return;
+
+      std::cout << "  [dbgroup] " << std::setw(5) << depth << std::setw(10) << lat.avg
+                << std::setw(10) << lat.p50 << std::setw(10) << lat.p99 << std::setw(13)
+                << memory / kRecNum;
+      if constexpr (HasConsolidate<Index>()) {
+        const auto begin = GetTimestamp();
+        index_->Consolidate();
+        const auto elapsed = GetTimestamp() - begin;
+        const auto after = MeasureReadLatency(ids, depth + 1);
+        std::cout << std::setw(18) << std::fixed << std::setprecision(3)
+                  << static_cast<double>(elapsed) / 1e6 << std::defaultfloat << std::setw(16)
+                  << after.avg;
+      }
+      std::cout << '\n';
+    }
+  }
+
   /*##########################################################################*
    * Static assertions
    *##########################################################################*/
@@ -643,6 +1737,9 @@ class IndexFixture : public ::testing::Test
   /// @brief Target IDs for random accesses.
   static inline std::vector<size_t> random;
 
+  /// @brief Prefix sums of the hash values of keys for scan checksums.
+  static inline std::vector<uint64_t> key_hash_sums;
+
   /*##########################################################################*
    * Internal member variables
    *##########################################################################*/
@@ -655,6 +1752,12 @@ class IndexFixture : public ::testing::Test
 
   /// @brief Record IDs for testing.
   const std::vector<size_t>* target_ids_{};
+
+  /// @brief A flag for tracing SMOs and the latency of write operations.
+  bool trace_smo_{false};
+
+  /// @brief SMOs reported by the index.
+  SMORecorder smo_recorder_{};
 };
 
 }  // namespace dbgroup::index::test
@@ -0,0 +1,480 @@
+/*
+ * Copyright 2026 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_INDEX_FIXTURES_INDEX_FIXTURE_HASH_HPP
+#define DBGROUP_INDEX_FIXTURES_INDEX_FIXTURE_HASH_HPP
+
+// C++ standard libraries
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// external libraries
+#include <gtest/gtest.h>
+
+// external C++ libraries
+#include <dbgroup/index/concepts.hpp>
+#include <dbgroup/index/utility.hpp>
+
+// local sources
+#include "common.hpp"
+#include "concepts.hpp"
+#include "index_wrapper.hpp"
+#include "metrics.hpp"
+
+namespace dbgroup::index::test
+{
+/*############################################################################*
+ * Fixture class definition
+ *############################################################################*/
+
+/**
+ * @brief A fixture for unordered (hash) indexes.
+ *
+ * This fixture uses only point operations. Each test prepares its own keys
+ * according to `HashKeyPattern`, and IDs in `[rec_num_, 2 * rec_num_)` denote
+ * keys that are never inserted (i.e., negative lookups).
+ *
+ * @tparam IndexInfo A class for specifying a target index.
+ */
+template <class IndexInfo>
+class HashIndexFixture : public ::testing::Test
+{
+  /*##########################################################################*
+   * Type aliases
+   *##########################################################################*/
+
+  using Key = typename IndexInfo::Key::Data;
+  using Payload = typename IndexInfo::Payload::Data;
+  using Comp = typename IndexInfo::Key::Comp;
+  using Index = typename IndexInfo::Index;
+  using IndexWrapper_t = IndexWrapper<IndexInfo>;
+
+ protected:
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  static constexpr uint32_t kUpdDelta = kDisableRecordMerging ? 0 : 1;
+  static constexpr size_t kLoadStepNum = 10;
+  static constexpr size_t kSampleNum = 10000;
+  static constexpr size_t kCollisionBits = 6;
+  static constexpr size_t kCollisionMask = (1UL << kCollisionBits) - 1;
+  static constexpr size_t kMaxCollisionKeyNum = 1UL << 14UL;
+  static constexpr size_t kWriterNum = std::max<size_t>(kThreadNum / 2, 1);
+
+  /*##########################################################################*
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+    if (index_) {
+      index_->TearDown();
+      index_ = nullptr;
+    }
+    if (!keys_.empty()) {
+      ReleaseTestData(keys_);
+      keys_ = {};
+    }
+  }
+
+  /*##########################################################################*
+   * Utility functions
+   *##########################################################################*/
+
+  /**
+   * @param pattern A pattern of keys.
+   * @retval true if the fixture can prepare the given pattern for the index.
+   * @retval false otherwise.
+   */
+  static constexpr auto
+  CanRunWith(                         //
+      const HashKeyPattern pattern)  //
+      -> bool
+  {
+    return HasRead<Index, Key, Payload>()                                            //
+           && (HasWrite<Index, Key, Payload>() || HasInsert<Index, Key, Payload>())  //
+           && (pattern != kHashCollisionKeys || HasKeyHash<Index, Key>());
+  }
+
+  /**
+   * @brief Prepare keys of a given pattern and construct an empty index.
+   *
+   * @param pattern A pattern of keys.
+   */
+  void
+  Preprocess(  //
+      const HashKeyPattern pattern)
+  {
+    TearDown();
+
+    const auto is_collided = pattern == kHashCollisionKeys;
+    rec_num_ = is_collided ? std::min(kExecNum, kMaxCollisionKeyNum) : kExecNum;
+    keys_ = PrepareHashKeys(pattern, 2 * rec_num_);
+
+    random_.resize(rec_num_);
+    for (size_t i = 0; i < rec_num_; ++i) {
+      random_[i] = i;
+    }
+    std::mt19937_64 rand_engine{kRandomSeed};
+    std::shuffle(random_.begin(), random_.end(), rand_engine);
+
+    index_ = std::make_unique<IndexWrapper_t>(keys_);
+    index_->SetUp();
+  }
+
+  /**
+   * @param pattern A pattern of keys.
+   * @param n The number of keys.
+   * @return Distinct keys of the given pattern. Strided keys share their low
+   * bits (or a long prefix for variable-length keys), and hash-collision keys
+   * share the low `kCollisionBits` bits of the index's hash values.
+   */
+  static auto
+  PrepareHashKeys(  //
+      const HashKeyPattern pattern,
+      const size_t n)  //
+      -> std::vector<Key>
+  {
+    constexpr auto kIsVar = std::is_same_v<Key, char*>;
+    constexpr auto kIsPtr = std::is_same_v<Key, uint64_t*>;
+    constexpr size_t kKeyBits = std::is_integral_v<Key> ? 8 * sizeof(Key) : 64;
+
+    if (pattern == kSequentialKeys) return PrepareTestData<Key>(n);
+
+    std::vector<Key> keys{};
+    keys.reserve(n);
+    [[maybe_unused]] VarData* var_arr{};
+    [[maybe_unused]] uint64_t* ptr_arr{};
+    if constexpr (kIsVar) {
+      var_arr = new VarData[n];
+    } else if constexpr (kIsPtr) {
+      ptr_arr = new uint64_t[n];
+    }
+
+    // a candidate key is placed in the next slot and removed if rejected
+    const auto shift = kKeyBits - std::bit_width(n);
+    for (uint64_t val = 0; keys.size() < n; ++val) {
+      const auto i = keys.size();
+      if constexpr (kIsVar) {
+        auto* data = var_arr[i].data;
+        const auto digits = static_cast<size_t>(std::snprintf(nullptr, 0, "%lu", val));
+        const auto prefix = (pattern == kStridedKeys) ? kVarDataLength - 1 - digits : 0;
+        std::memset(data, 'x', prefix);
+        std::snprintf(data + prefix, kVarDataLength - prefix, "%lu", val);
+        keys.emplace_back(data);
+      } else if constexpr (kIsPtr) {
+        ptr_arr[i] = (pattern == kStridedKeys) ? val << shift : val;
+        keys.emplace_back(ptr_arr + i);
+      } else {
+        keys.emplace_back(static_cast<Key>((pattern == kStridedKeys) ? val << shift : val));
+      }
+
+      if constexpr (HasKeyHash<Index, Key>()) {
+        if (pattern == kHashCollisionKeys && (Index::GetHash(keys.back()) & kCollisionMask) != 0) {
+          keys.pop_back();
+        }
+      }
+    }
+
+    return keys;
+  }
+
+  void
+  Load(  //
+      const size_t id)
+  {
+    if constexpr (HasInsert<Index, Key, Payload>()) {
+      EXPECT_FALSE(index_->Insert(id)) << "[Insert: RC]";
+    } else {
+      index_->Write(id);
+    }
+  }
+
+  /*##########################################################################*
+   * Functions for verification
+   *##########################################################################*/
+
+  /**
+   * @brief Verify point operations over keys of a given pattern.
+   *
+   * This function loads all the keys and checks reads of present/absent keys,
+   * duplicate inserts, updates, and deletes followed by re-inserts (i.e., the
+   * reuse of tombstones).
+   *
+   * @param pattern A pattern of keys.
+   */
+  void
+  VerifyPointOperationsWith(  //
+      const HashKeyPattern pattern)
+  {
+    if (!CanRunWith(pattern)) {
+      GTEST_SKIP();
+    }
+
+    Preprocess(pattern);
+    for (const auto id : random_) {
+      Load(id);
+    }
+    if (HasFailure()) return;
+
+    auto verify_read = [&](const uint32_t expected_val, const size_t parity) {
+      for (size_t i = 0; i < rec_num_; ++i) {
+        const auto id = random_[i];
+        const auto& ret = index_->Read(id);
+        if (i % 2 == parity) {
+          ASSERT_FALSE(ret) << "[Read: RC]";
+        } else {
+          ASSERT_TRUE(ret) << "[Read: RC]";
+          ASSERT_EQ(static_cast<uint32_t>(ret.value()), expected_val) << "[Read: returned value]";
+        }
+      }
+      for (size_t id = rec_num_; id < 2 * rec_num_; ++id) {
+        ASSERT_FALSE(index_->Read(id)) << "[Read: absent key]";
+      }
+    };
+    constexpr size_t kNoDeleted = 2;
+    verify_read(1, kNoDeleted);
+
+    uint32_t expected_val = 1;
+    if constexpr (HasInsert<Index, Key, Payload>()) {
+      for (const auto id : random_) {
+        ASSERT_TRUE(index_->Insert(id)) << "[Insert: duplicate key]";
+      }
+    }
+    if constexpr (HasUpdate<Index, Key, Payload>()) {
+      for (const auto id : random_) {
+        ASSERT_TRUE(index_->Update(id)) << "[Update: RC]";
+      }
+      for (size_t id = rec_num_; id < 2 * rec_num_; ++id) {
+        ASSERT_FALSE(index_->Update(id)) << "[Update: absent key]";
+      }
+      expected_val += kUpdDelta;
+      verify_read(expected_val, kNoDeleted);
+    }
+
+    if constexpr (HasDelete<Index, Key, Payload>()) {
+      for (size_t i = 0; i < rec_num_; i += 2) {
+        ASSERT_TRUE(index_->Delete(random_[i])) << "[Delete: RC]";
+      }
+      verify_read(expected_val, 0);
+
+      // re-inserted keys must be found among remaining colliding keys
+      for (size_t i = 0; i < rec_num_; i += 2) {
+        Load(random_[i]);
+      }
+      for (size_t i = 0; i < rec_num_; i += 2) {
+        const auto& ret = index_->Read(random_[i]);
+        ASSERT_TRUE(ret) << "[Read: re-inserted key]";
+        ASSERT_EQ(static_cast<uint32_t>(ret.value()), 1) << "[Read: returned value]";
+      }
+    }
+  }
+
+  /*##########################################################################*
+   * Functions for performance measurements
+   *##########################################################################*/
+
+  /**
+   * @brief Measure point operations while filling an index step by step.
+   *
+   * The index preallocates space for all the keys if it supports `Reserve`, so
+   * each step corresponds to a fill ratio of the reserved capacity. Otherwise,
+   * the index resizes itself and the maximum insert latency shows the cost.
+   *
+   * @param pattern A pattern of keys.
+   */
+  void
+  MeasureLoadFactorSweepWith(  //
+      const HashKeyPattern pattern)
+  {
+    if (!CanRunWith(pattern)) {
+      GTEST_SKIP();
+    }
+
+    Preprocess(pattern);
+    const auto heap_base = GetHeapUsage();
+    index_->Reserve(rec_num_);
+
+    std::cout << "  [dbgroup] " << std::setw(6) << "fill" << std::setw(13) << "load factor"
+              << std::setw(13) << "insert [ns]" << std::setw(17) << "max insert [us]"
+              << std::setw(10) << "hit [ns]" << std::setw(11) << "miss [ns]" << std::setw(13)
+              << "mem/key [B]" << '\n';
+
+    size_t loaded = 0;
+    for (size_t step = 1; step <= kLoadStepNum && !HasFailure(); ++step) {
+      const auto end = rec_num_ * step / kLoadStepNum;
+      if (end == 0) continue;  // fewer keys than steps
+
+      const auto load_num = std::max<size_t>(end - loaded, 1);
+      uint64_t max_lat = 0;
+      const auto load_begin = GetTimestamp();
+      for (; loaded < end; ++loaded) {
+        const auto begin = GetTimestamp();
+        Load(random_[loaded]);
+        max_lat = std::max(max_lat, GetTimestamp() - begin);
+      }
+      const auto load_ns = (GetTimestamp() - load_begin) / load_num;
+      const auto memory = GetIndexMemoryUsage<Index>(*index_, heap_base);
+
+      // sample present and absent keys evenly
+      const auto sample_num = std::min(kSampleNum, loaded);
+      const auto hit_begin = GetTimestamp();
+      for (size_t i = 0; i < sample_num; ++i) {
+        const auto& ret = index_->Read(random_[i * loaded / sample_num]);
+        ASSERT_TRUE(ret) << "[Read: RC]";
+      }
+      const auto hit_ns = (GetTimestamp() - hit_begin) / std::max<size_t>(sample_num, 1);
+      const auto miss_begin = GetTimestamp();
+      for (size_t i = 0; i < sample_num; ++i) {
+        ASSERT_FALSE(index_->Read(rec_num_ + i)) << "[Read: absent key]";
+      }
+      const auto miss_ns = (GetTimestamp() - miss_begin) / std::max<size_t>(sample_num, 1);
+
+      std::cout << "  [dbgroup] " << std::setw(5) << step * 100 / kLoadStepNum << '%';
+      if (const auto& lf = index_->GetLoadFactor(); lf) {
+        std::cout << std::setw(13) << std::fixed << std::setprecision(3) << *lf
+                  << std::defaultfloat;
+      } else {
+        std::cout << std::setw(13) << "-";
+      }
+      std::cout << std::setw(13) << load_ns << std::setw(17) << max_lat / 1000 << std::setw(10)
+                << hit_ns << std::setw(11) << miss_ns << std::setw(13) << memory / loaded << '\n';
+    }
+  }
+
+  /**
+   * @brief Measure the latency of resizing under concurrent reads.
+   *
+   * The half of threads insert all the keys into an empty index, and the
+   * others read random keys until the inserts finish. Each resize stalls
+   * operations, and so this function reports maximum latency in addition to
+   * percentiles. If the index reports resizes via `SetSMOHandler`, their number
+   * and the overlap with tail read latency are also reported.
+   *
+   * @param pattern A pattern of keys.
+   */
+  void
+  MeasureResizeUnderLoadWith(  //
+      const HashKeyPattern pattern)
+  {
+    constexpr auto kTraceSMOs = HasSMOHandler<Index>();
+
+    if (!CanRunWith(pattern)) {
+      GTEST_SKIP();
+    }
+
+    LatencyRecorder insert_latency{kThreadNum};
+    LatencyRecorder read_latency{kThreadNum};
+    std::atomic_size_t finished_num{0};
+
+    auto mt_worker = [&](const size_t w_id) -> void {
+      if (w_id < kWriterNum) {
+        insert_latency.Reserve(w_id, rec_num_ / kWriterNum + 1);
+        for (size_t i = w_id; i < rec_num_ && !HasFailure(); i += kWriterNum) {
+          const auto begin = GetTimestamp();
+          Load(random_[i]);
+          insert_latency.Record(w_id, begin, GetTimestamp());
+        }
+        ++finished_num;
+        return;
+      }
+
+      std::mt19937_64 rand_engine{kRandomSeed + w_id};
+      std::uniform_int_distribution<size_t> id_dist{0, rec_num_ - 1};
+      while (finished_num < kWriterNum && !HasFailure()) {
+        const auto begin = GetTimestamp();
+        const auto& ret = index_->Read(id_dist(rand_engine));
+        read_latency.Record(w_id, begin, GetTimestamp());
+        if (ret) {
+          ASSERT_EQ(static_cast<uint32_t>(ret.value()), 1) << "[Read: returned value]";
+        }
+      }
+    };
+
+    Preprocess(pattern);
+    if constexpr (kTraceSMOs) {
+      smo_recorder_.Clear();
+      index_->SetSMOHandler([&](const SMOType type) { smo_recorder_.Record(type); });
+    }
+
+    std::cout << "  [dbgroup] insert " << rec_num_ << " keys with concurrent reads...\n";
+    const auto begin = GetTimestamp();
+    index_->RunWorkers(kThreadNum, mt_worker);
+    const auto sec = static_cast<double>(GetTimestamp() - begin) / 1e9;
+    if (HasFailure()) return;
+
+    auto report = [&](const char* label, const LatencyRecorder& latency) {
+      auto&& lats = latency.GetLatencies();
+      const auto max_lat = lats.empty() ? 0 : *std::max_element(lats.begin(), lats.end());
+      std::cout << "  [dbgroup] " << label << ": " << static_cast<size_t>(lats.size() / sec)
+                << " ops/s, p50 " << GetQuantile(lats, 0.5) << " ns, p99 "
+                << GetQuantile(lats, 0.99) << " ns, p99.9 " << GetQuantile(lats, 0.999)
+                << " ns, max " << max_lat << " ns\n";
+    };
+    report("insert", insert_latency);
+    report("read", read_latency);
+    if constexpr (kTraceSMOs) {
+      smo_recorder_.Report(read_latency);
+    }
+
+    for (const auto id : random_) {
+      const auto& ret = index_->Read(id);
+      ASSERT_TRUE(ret) << "[Read: RC]";
+      ASSERT_EQ(static_cast<uint32_t>(ret.value()), 1) << "[Read: returned value]";
+    }
+  }
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief Keys of the current test.
+  std::vector<Key> keys_{};
+
+  /// @brief The number of keys to be inserted.
+  size_t rec_num_{};
+
+  /// @brief The IDs of keys to be inserted in random order.
+  std::vector<size_t> random_{};
+
+  /// @brief An index for testing.
+  std::unique_ptr<IndexWrapper_t> index_{};
+
+  /// @brief A recorder for resizes reported by an index.
+  SMORecorder smo_recorder_{};
+};
+
+}  // namespace dbgroup::index::test
+
+#endif  // DBGROUP_INDEX_FIXTURES_INDEX_FIXTURE_HASH_HPP
@@ -0,0 +1,51 @@
+/*----------------------------------------------------------------------------*
+ * Point operations
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(HashIndexFixture, PointOperationsWithSequentialKeys)
+{
+  TestFixture::VerifyPointOperationsWith(kSequentialKeys);
+}
+
+TYPED_TEST(HashIndexFixture, PointOperationsWithStridedKeys)
+{
+  TestFixture::VerifyPointOperationsWith(kStridedKeys);
+}
+
+TYPED_TEST(HashIndexFixture, PointOperationsWithHashCollisionKeys)
+{
+  TestFixture::VerifyPointOperationsWith(kHashCollisionKeys);
+}
+
+/*----------------------------------------------------------------------------*
+ * Load-factor sweeps
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(HashIndexFixture, LoadFactorSweepWithSequentialKeys)
+{
+  TestFixture::MeasureLoadFactorSweepWith(kSequentialKeys);
+}
+
+TYPED_TEST(HashIndexFixture, LoadFactorSweepWithStridedKeys)
+{
+  TestFixture::MeasureLoadFactorSweepWith(kStridedKeys);
+}
+
+TYPED_TEST(HashIndexFixture, LoadFactorSweepWithHashCollisionKeys)
+{
+  TestFixture::MeasureLoadFactorSweepWith(kHashCollisionKeys);
+}
+
+/*----------------------------------------------------------------------------*
+ * Resizing under load
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(HashIndexFixture, ResizeUnderLoadWithSequentialKeys)
+{
+  TestFixture::MeasureResizeUnderLoadWith(kSequentialKeys);
+}
+
+TYPED_TEST(HashIndexFixture, ResizeUnderLoadWithHashCollisionKeys)
+{
+  TestFixture::MeasureResizeUnderLoadWith(kHashCollisionKeys);
+}
@@ -20,11 +20,15 @@
 // C++ standard libraries
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iomanip>
+#include <limits>
 #include <memory>
 #include <random>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -38,8 +42,12 @@
 #include <dbgroup/thread/id_manager.hpp>
 
 // local sources
+#include "cluster.hpp"
 #include "common.hpp"
+#include "concepts.hpp"
 #include "index_wrapper.hpp"
+#include "metrics.hpp"
+#include "transport.hpp"
 
 namespace dbgroup::index::test
 {
@@ -66,8 +74,22 @@ class IndexMultiThreadFixture : public testing::Test
    *##########################################################################*/
 
   static constexpr size_t kScanSize = 1000;
-  static constexpr uint32_t kInitVal = kDisableRecordMerging ? 1 : kWorkerNum;
-  static constexpr uint32_t kUpdDelta = kDisableRecordMerging ? 0 : kWorkerNum;
+  static constexpr size_t kSamplingInterval = 100;  // us
+  static constexpr size_t kWindowRatio = 10;
+  static constexpr uint32_t kInitVal = kDisableRecordMerging ? 1 : kWritersPerKey;
+  static constexpr uint32_t kUpdDelta = kDisableRecordMerging ? 0 : kWritersPerKey;
+
+  /*##########################################################################*
+   * Internal types
+   *##########################################################################*/
+
+  /// @brief Phases of a time-bounded execution.
+  enum Phase : uint8_t {
+    kWarmup,
+    kMeasure,
+    kCooldown,
+    kFinished,
+  };
 
   /*##########################################################################*
    * Setup/Teardown
@@ -80,9 +102,13 @@ class IndexMultiThreadFixture : public testing::Test
 
     keys = PrepareTestData<Key>(kExecNum + 1);
 
+    // each node accesses the keys assigned by the key-partitioning policy
+    const auto node_id = NodeContext::GetNodeID();
     forward.reserve(kExecNum);
     for (size_t i = 0; i < kExecNum; ++i) {
-      forward.emplace_back(i);
+      if (IsTargetKey(i, node_id)) {
+        forward.emplace_back(i);
+      }
     }
 
     backward = forward;
@@ -139,11 +165,15 @@ class IndexMultiThreadFixture : public testing::Test
       pos = 0;
     } else {  // pattern == kRandom
       target_ids = &random;
-      pos = std::random_device{}() % kExecNum;
+      // a node may have no keys with HASH/RANGE partitioning over many nodes
+      pos = random.empty() ? 0 : std::random_device{}() % random.size();
     }
-    exec_num = rec_num;
+    exec_num = std::min(rec_num, target_ids->size());
 
-    ++ready_num_;
+    const auto slot = ready_num_++;
+    op_counter = timeline_ ? timeline_->GetCounter(slot) : nullptr;
+    measured_counter = &measured_[slot];
+    executed_counter = time_bounded_ ? nullptr : measured_counter;
     while (!is_ready_) {
       std::this_thread::yield();
     }
@@ -160,10 +190,67 @@ class IndexMultiThreadFixture : public testing::Test
     return id;
   }
 
+  /**
+   * @brief Count an executed operation for the throughput timeline.
+   *
+   * Workers should call this function after each operation instead of each
+   * `GetID()`, since some workers skip IDs without any operation. In count-based
+   * executions, the operation is also counted for reporting round trips.
+   */
+  static void
+  CountOperation()
+  {
+    if (op_counter != nullptr) {
+      op_counter->Increment();
+    }
+    if (executed_counter != nullptr) {
+      executed_counter->Increment();
+    }
+  }
+
+  /**
+   * @brief Check the phase of a time-bounded execution.
+   *
+   * Workers should call this function before each operation. The operation is
+   * counted as a measured one if the measurement phase is in progress.
+   *
+   * @retval true if a worker should continue the current execution.
+   * @retval false if the execution has finished.
+   */
+  auto
+  KeepRunning()  //
+      -> bool
+  {
+    const auto phase = phase_.load(std::memory_order_relaxed);
+    if (phase == kMeasure) {
+      measured_counter->Increment();
+    }
+    return phase != kFinished;
+  }
+
+  /**
+   * @brief Run the given worker function with `kThreadNum` threads.
+   *
+   * If this process is a node of a local cluster, workers start after all the
+   * nodes have prepared their workers.
+   *
+   * @param func A worker function.
+   * @param time_bounded A flag for running workers until a shared deadline. In
+   * this case, workers must check `KeepRunning()` for each operation.
+   */
   void
   RunMT(  //
-      const std::function<void(size_t)>& func)
+      const std::function<void(size_t)>& func,
+      const bool time_bounded = false)
   {
+    if constexpr (kTimelineInterval > 0) {
+      timeline_ = std::make_unique<ThroughputTimeline>(kThreadNum, kTimelineInterval);
+      if (memory_sampler_) {
+        timeline_->SampleMemoryWith(memory_sampler_);
+      }
+    }
+
+    time_bounded_ = time_bounded;
     std::vector<std::thread> threads{};
     threads.reserve(kThreadNum);
     for (size_t i = 0; i < kThreadNum; ++i) {
@@ -172,16 +259,96 @@ class IndexMultiThreadFixture : public testing::Test
     while (ready_num_ < kThreadNum) {
       std::this_thread::yield();
     }
-    is_ready_ = true;
+    NodeContext::Barrier();  // start workers on all the nodes together
+    if (timeline_) {
+      timeline_->Start();
+    }
+    if (time_bounded) {
+      is_ready_ = true;
+      ControlPhases();
+    } else {
+      round_trips_begin_ = LoopbackTransport::GetRoundTrips();
+      is_ready_ = true;
+    }
     for (auto&& t : threads) {
       t.join();
     }
+    if (!time_bounded) {
+      round_trips_end_ = LoopbackTransport::GetRoundTrips();
+    }
+    if (timeline_) {
+      timeline_->Stop();
+      timeline_->Report();
+      timeline_ops_ = timeline_->GetTotal();
+      timeline_ = nullptr;
+    }
+    ReportMeasuredOperations();
 
     is_ready_ = false;
     ready_num_ = 0;
     index_->Barrier();
   }
 
+  void
+  ControlPhases()
+  {
+    using std::chrono::milliseconds;
+
+    std::this_thread::sleep_for(milliseconds{kWarmupDuration});
+    measure_begin_ = GetTimestamp();
+    round_trips_begin_ = LoopbackTransport::GetRoundTrips();
+    phase_ = kMeasure;
+    std::this_thread::sleep_for(milliseconds{kPhaseDuration});
+    phase_ = kCooldown;
+    measure_end_ = GetTimestamp();
+    round_trips_end_ = LoopbackTransport::GetRoundTrips();
+
+    // keep all the workers running until the end of measurement
+    std::this_thread::sleep_for(milliseconds{kCooldownDuration});
+    phase_ = kFinished;
+  }
+
+  /**
+   * @brief Report the throughput and round trips of the last execution.
+   *
+   * The throughput is reported only for a time-bounded execution. Round trips
+   * are reported as raw counts with the number of operations, so that the
+   * coordinator of a local cluster can compute round trips per operation after
+   * summing them over the nodes (see `LocalCluster::Report`).
+   */
+  void
+  ReportMeasuredOperations()
+  {
+    size_t total = 0;
+    for (auto&& counter : measured_) {
+      total += counter.Load();
+      counter.cnt = 0;
+    }
+    phase_ = kWarmup;
+
+    const auto* info = testing::UnitTest::GetInstance()->current_test_info();
+    const auto name = std::string{info->test_suite_name()} + "." + info->name();
+    if (time_bounded_) {
+      const auto sec = static_cast<double>(measure_end_ - measure_begin_) / 1e9;
+      std::cout << "  [dbgroup] throughput: " << static_cast<size_t>(total / sec) << " ops/s ("
+                << total << " ops in " << (measure_end_ - measure_begin_) / 1000000 << " ms)\n";
+
+      // sum up throughput over nodes if this process is a node of a local cluster
+      NodeContext::ReportMetric(name + ".throughput", total / sec);
+    }
+
+    // report the efficiency of an index using the emulated network
+    if (round_trips_end_ > round_trips_begin_ && total > 0) {
+      const auto round_trips = round_trips_end_ - round_trips_begin_;
+      std::cout << "  [dbgroup] round trips: " << static_cast<double>(round_trips) / total
+                << " per op (" << round_trips << " round trips in " << total << " ops)\n";
+      NodeContext::ReportMetric(name + kRoundTripsSuffix, static_cast<double>(round_trips));
+      NodeContext::ReportMetric(name + kOpsSuffix, static_cast<double>(total));
+    }
+    round_trips_begin_ = 0;
+    round_trips_end_ = 0;
+  }
+
   /*##########################################################################*
    * Functions for verification
    *##########################################################################*/
@@ -196,9 +363,10 @@ class IndexMultiThreadFixture : public testing::Test
     auto mt_worker = [&]([[maybe_unused]] const size_t w_id) -> void {
       PrepareTargetIDs();
       index_->SetUp();
-      for (size_t i = 0; i < kExecNum; ++i) {
+      for (size_t i = 0; i < exec_num; ++i) {
         const auto id = GetID();
         const auto& ret = index_->Read(id);
+        CountOperation();
         if (HasFailure()) return;
 
         if (expect_success) {
@@ -225,7 +393,7 @@ class IndexMultiThreadFixture : public testing::Test
     auto mt_worker = [&](const size_t w_id) -> void {
       PrepareTargetIDs();
       index_->SetUp();
-      for (size_t i = 0; i < kExecNum; ++i) {
+      for (size_t i = 0; i < exec_num; ++i) {
         auto id = GetID();
         if (id % kThreadNum != w_id || id > kExecNum - kThreadNum) continue;
         const auto end_id = id + kThreadNum;
@@ -247,6 +415,7 @@ class IndexMultiThreadFixture : public testing::Test
           ASSERT_EQ(id, end_id) << "[Scan: # of scanned records]";
         }
         ASSERT_FALSE(iter) << "[Scan: iterator reach end]";
+        CountOperation();
       }
       index_->TearDown();
     };
@@ -265,7 +434,7 @@ class IndexMultiThreadFixture : public testing::Test
     auto mt_worker = [&](const size_t w_id) -> void {
       PrepareTargetIDs();
       index_->SetUp();
-      for (size_t i = 0; i < kExecNum; ++i) {
+      for (size_t i = 0; i < exec_num; ++i) {
         auto id = GetID();
         if (id % kThreadNum != w_id || id < kThreadNum) continue;
         const auto begin_id = id - kThreadNum;
@@ -287,6 +456,7 @@ class IndexMultiThreadFixture : public testing::Test
           ASSERT_EQ(id, begin_id) << "[ScanBackward: # of scanned records]";
         }
         ASSERT_FALSE(iter) << "[ScanBackward: iterator reach end]";
+        CountOperation();
       }
       index_->TearDown();
     };
@@ -303,9 +473,10 @@ class IndexMultiThreadFixture : public testing::Test
     auto mt_worker = [&]([[maybe_unused]] const size_t w_id) -> void {
       PrepareTargetIDs();
       index_->SetUp();
-      for (size_t i = 0; i < kExecNum; ++i) {
+      for (size_t i = 0; i < exec_num; ++i) {
         const auto id = GetID();
         index_->Write(id);
+        CountOperation();
         if (HasFailure()) return;
       }
       index_->TearDown();
@@ -324,9 +495,10 @@ class IndexMultiThreadFixture : public testing::Test
     auto mt_worker = [&]([[maybe_unused]] const size_t w_id) -> void {
       PrepareTargetIDs();
       index_->SetUp();
-      for (size_t i = 0; i < kExecNum; ++i) {
+      for (size_t i = 0; i < exec_num; ++i) {
         const auto id = GetID();
         const auto& ret = index_->Upsert(id);
+        CountOperation();
         if (HasFailure()) return;
 
         if (ret) {
@@ -349,9 +521,10 @@ class IndexMultiThreadFixture : public testing::Test
     auto mt_worker = [&]([[maybe_unused]] const size_t w_id) -> void {
       PrepareTargetIDs();
       index_->SetUp();
-      for (size_t i = 0; i < kExecNum; ++i) {
+      for (size_t i = 0; i < exec_num; ++i) {
         const auto id = GetID();
         const auto& ret = index_->Insert(id);
+        CountOperation();
         if (HasFailure()) return;
 
         if (ret) {
@@ -375,9 +548,10 @@ class IndexMultiThreadFixture : public testing::Test
     auto mt_worker = [&]([[maybe_unused]] const size_t w_id) -> void {
       PrepareTargetIDs();
       index_->SetUp();
-      for (size_t i = 0; i < kExecNum; ++i) {
+      for (size_t i = 0; i < exec_num; ++i) {
         const auto id = GetID();
         const auto& ret = index_->Update(id);
+        CountOperation();
         if (HasFailure()) return;
 
         if (expect_success) {
@@ -404,9 +578,10 @@ class IndexMultiThreadFixture : public testing::Test
     auto mt_worker = [&]([[maybe_unused]] const size_t w_id) -> void {
       PrepareTargetIDs();
       index_->SetUp();
-      for (size_t i = 0; i < kExecNum; ++i) {
+      for (size_t i = 0; i < exec_num; ++i) {
         const auto id = GetID();
         const auto& ret = index_->Delete(id);
+        CountOperation();
         if (HasFailure()) return;
 
         if (ret) {
@@ -588,6 +763,34 @@ class IndexMultiThreadFixture : public testing::Test
     VerifyScanBackward(kExpectFailed, expected_val);
   }
 
+  /**
+   * @brief Verify that the throughput timeline counts executed operations.
+   *
+   * Each scan worker skips the IDs assigned to the other workers, so the
+   * timeline must count only the scans actually performed.
+   */
+  void
+  VerifyTimelineCounts()
+  {
+    if (kTimelineInterval == 0                //
+        || !HasWrite<Index, Key, Payload>()   //
+        || !HasScan<Index, Key, Payload>())   //
+    {
+      GTEST_SKIP();
+    }
+
+    Preprocess(kRandom);
+    VerifyWrite();
+    if (HasFailure()) return;
+    ASSERT_EQ(timeline_ops_, kThreadNum * forward.size()) << "[Timeline: # of writes]";
+
+    VerifyScanForward(kExpectSuccess, kInitVal);
+    if (HasFailure()) return;
+    const auto scan_num = std::count_if(forward.begin(), forward.end(),  //
+                                        [](const size_t id) { return id <= kExecNum - kThreadNum; });
+    ASSERT_EQ(timeline_ops_, static_cast<size_t>(scan_num)) << "[Timeline: # of scans]";
+  }
+
   void
   VerifyConcurrentSMOs()
   {
@@ -595,7 +798,7 @@ class IndexMultiThreadFixture : public testing::Test
     constexpr size_t kDeleteThread = kThreadNum * 1 / 4;
     constexpr size_t kReadThread = kThreadNum * 2 / 4;
     constexpr size_t kScanThread = kThreadNum * 3 / 4;
-    constexpr size_t kMaxVal = kRepeatNum * kWorkerNum;
+    constexpr size_t kMaxVal = kRepeatNum * kWritersPerKey;
     std::atomic_size_t counter{};
 
     if (!HasWrite<Index, Key, Payload>()      //
@@ -605,11 +808,21 @@ class IndexMultiThreadFixture : public testing::Test
       GTEST_SKIP();
     }
 
+    constexpr auto kTraceSMOs = HasSMOHandler<Index>();
+    LatencyRecorder latency{kThreadNum};
+
     auto mt_worker = [&](const size_t w_id) -> void {
       PrepareTargetIDs();
+      if constexpr (kTraceSMOs) {
+        latency.Reserve(w_id, exec_num);
+      }
       index_->SetUp();
-      for (size_t i = 0; i < kExecNum; ++i) {
+      for (size_t i = 0; i < exec_num; ++i) {
         const auto id = GetID();
+        [[maybe_unused]] uint64_t begin{};
+        if constexpr (kTraceSMOs) {
+          begin = GetTimestamp();
+        }
         if (w_id >= kScanThread) {
           auto&& iter = index_->Scan(id);
           for (size_t i = 0; iter && i < kScanSize; ++iter, ++i) {
@@ -630,6 +843,10 @@ class IndexMultiThreadFixture : public testing::Test
         } else {
           index_->Write(id);
         }
+        if constexpr (kTraceSMOs) {
+          latency.Record(w_id, begin, GetTimestamp());
+        }
+        CountOperation();
         if (HasFailure()) break;
       }
       counter += 1;
@@ -637,11 +854,517 @@ class IndexMultiThreadFixture : public testing::Test
     };
 
     Preprocess(kRandom);
+    if constexpr (kTraceSMOs) {
+      index_->SetSMOHandler([&](const SMOType type) { smo_recorder_.Record(type); });
+    }
     std::cout << "  [dbgroup] initialization...\n";
     for (size_t i = 0; i < kRepeatNum && !HasFailure(); ++i) {
       std::cout << "  [dbgroup] repeat #" << i << "...\n";
       counter = 0;
       RunMT(mt_worker);
+      if constexpr (kTraceSMOs) {
+        smo_recorder_.Report(latency);
+        smo_recorder_.Clear();
+        latency.Clear();
+      }
+    }
+  }
+
+  void
+  MeasureThroughputWith(  //
+      const WriteOperation write_ops,
+      const AccessPattern pattern)
+  {
+    if (kPhaseDuration == 0                                                         //
+        || (!HasWrite<Index, Key, Payload>() && !HasInsert<Index, Key, Payload>())  //
+        || write_ops == kInsert || write_ops == kDelete                             //
+        || (write_ops == kWithoutWrite && !HasRead<Index, Key, Payload>())          //
+        || (write_ops == kWrite && !HasWrite<Index, Key, Payload>())                //
+        || (write_ops == kUpsert && !HasUpsert<Index, Key, Payload>())              //
+        || (write_ops == kUpdate && !HasUpdate<Index, Key, Payload>()))             //
+    {
+      GTEST_SKIP();
+    }
+
+    auto mt_worker = [&]([[maybe_unused]] const size_t w_id) -> void {
+      PrepareTargetIDs();
+      index_->SetUp();
+      while (KeepRunning()) {
+        const auto id = GetID();
+        switch (write_ops) {
+          case kWrite:
+            index_->Write(id);
+            break;
+          case kUpsert:
+            index_->Upsert(id);
+            break;
+          case kUpdate:
+            ASSERT_TRUE(index_->Update(id)) << "[Update: RC]";
+            break;
+          case kWithoutWrite:
+          default:
+            ASSERT_TRUE(index_->Read(id)) << "[Read: RC]";
+            break;
+        }
+        CountOperation();
+        if (HasFailure()) break;
+      }
+      index_->TearDown();
+    };
+
+    Preprocess(pattern);
+    if constexpr (HasWrite<Index, Key, Payload>()) {
+      VerifyWrite();
+    } else {
+      VerifyInsert(1);
+    }
+
+    std::cout << "  [dbgroup] time-bounded execution...\n";
+    RunMT(mt_worker, kTimeBounded);
+  }
+
+  /**
+   * @brief Measure read throughput with lookups for absent keys.
+   *
+   * Workers look up absent (gap) keys with the probability of `kMissPercent`
+   * percent and present keys otherwise.
+   *
+   * @param gaps A pattern of absent keys.
+   */
+  void
+  MeasureReadWithMisses(  //
+      const GapPattern gaps)
+  {
+    if (kPhaseDuration == 0 || !HasRead<Index, Key, Payload>()                       //
+        || (!HasWrite<Index, Key, Payload>() && !HasInsert<Index, Key, Payload>()))  //
+    {
+      GTEST_SKIP();
+    }
+
+    std::vector<size_t> present{};
+    std::vector<size_t> absent{};
+    for (const auto id : forward) {
+      (IsGapKey(id, gaps) ? absent : present).emplace_back(id);
+    }
+    if (present.empty() || absent.empty()) GTEST_SKIP();
+
+    auto load_worker = [&]([[maybe_unused]] const size_t w_id) -> void {
+      PrepareTargetIDs();
+      index_->SetUp();
+      for (size_t i = 0; i < exec_num; ++i) {
+        const auto id = GetID();
+        if (IsGapKey(id, gaps)) continue;
+        if constexpr (HasWrite<Index, Key, Payload>()) {
+          index_->Write(id);
+        } else {
+          index_->Insert(id);
+        }
+        CountOperation();
+        if (HasFailure()) break;
+      }
+      index_->TearDown();
+    };
+
+    auto mt_worker = [&](const size_t w_id) -> void {
+      PrepareTargetIDs();
+      std::mt19937_64 rand_engine{w_id};
+      index_->SetUp();
+      while (KeepRunning()) {
+        const auto is_miss = rand_engine() % 100 < kMissPercent;
+        const auto& ids = is_miss ? absent : present;
+        const auto& ret = index_->Read(ids[rand_engine() % ids.size()]);
+        CountOperation();
+        ASSERT_EQ(static_cast<bool>(ret), !is_miss) << "[Read: RC]";
+        if (HasFailure()) break;
+      }
+      index_->TearDown();
+    };
+
+    Preprocess(kRandom);
+    std::cout << "  [dbgroup] load keys with gaps...\n";
+    RunMT(load_worker);
+    std::cout << "  [dbgroup] time-bounded read with " << kMissPercent << "% misses...\n";
+    RunMT(mt_worker, kTimeBounded);
+  }
+
+  /**
+   * @brief Run a time-series workload over a sliding window of keys.
+   *
+   * Writers append monotonically increasing keys and delete the key that falls
+   * out of the trailing window, while readers look up keys in the recent half
+   * of the window. Writers stop after `DBGROUP_TEST_PHASE_DURATION_MS` if it is
+   * set, and otherwise when all the keys are appended once. Memory consumption
+   * is reported whenever a window's worth of keys is appended, and a sampler
+   * thread measures it so that writers are not delayed by sampling.
+   */
+  void
+  MeasureSlidingWindow()
+  {
+    constexpr size_t kReaderNum = (kThreadNum > 1) ? std::max(kThreadNum / 4, 1UL) : 0;
+    constexpr size_t kWriterNum = kThreadNum - kReaderNum;
+    constexpr size_t kWindowSize = std::max(kExecNum / kWindowRatio / kWriterNum, 1UL) * kWriterNum;
+
+    if ((!HasWrite<Index, Key, Payload>() && !HasInsert<Index, Key, Payload>())  //
+        || !HasDelete<Index, Key, Payload>()                                     //
+        || (kReaderNum > 0 && !HasRead<Index, Key, Payload>()))                  //
+    {
+      GTEST_SKIP();
+    }
+
+    constexpr size_t kKeysPerWindow = kWindowSize / kWriterNum;
+
+    std::atomic_size_t head{0};
+    std::atomic_size_t finished_num{0};
+    std::atomic_size_t read_num{0};
+    std::atomic_size_t hit_num{0};
+    std::atomic_size_t first_appended{0};
+    std::vector<size_t> append_nums(kWriterNum, 0);
+    std::vector<size_t> window_mems{};
+    window_mems.reserve(kWindowRatio + 1);
+
+    auto mt_worker = [&](const size_t w_id) -> void {
+      PrepareTargetIDs();
+      index_->SetUp();
+      if (w_id < kWriterNum) {
+        const auto deadline = (kPhaseDuration > 0) ? GetTimestamp() + kPhaseDuration * 1000000UL
+                                                   : std::numeric_limits<uint64_t>::max();
+        // each writer deletes its own keys, so deleted keys must exist. Failures
+        // break the loop instead of returning to count this writer as finished
+        auto& cnt = append_nums[w_id];
+        for (size_t id = w_id; id < kExecNum && GetTimestamp() < deadline; id += kWriterNum) {
+          if constexpr (HasWrite<Index, Key, Payload>()) {
+            index_->Write(id);
+          } else {
+            const auto& rc = index_->Insert(id);
+            EXPECT_FALSE(rc) << "[Insert: RC]";
+            if (rc) break;
+          }
+          head.store(id, std::memory_order_relaxed);
+          if (id >= kWindowSize) {
+            const auto& rc = index_->Delete(id - kWindowSize);
+            EXPECT_TRUE(rc) << "[Delete: RC]";
+            if (!rc) break;
+          }
+          CountOperation();
+          if (++cnt % kKeysPerWindow == 0 && w_id == 0) {
+            first_appended.store(cnt, std::memory_order_relaxed);
+          }
+          if (HasFailure()) break;
+        }
+        ++finished_num;
+      } else {
+        std::mt19937_64 rand_engine{w_id};
+        size_t reads = 0;
+        size_t hits = 0;
+        while (finished_num < kWriterNum && !HasFailure()) {
+          const auto end = head.load(std::memory_order_relaxed) + 1;
+          const auto begin = (end > kWindowSize / 2) ? end - kWindowSize / 2 : 0;
+          const auto& ret = index_->Read(begin + rand_engine() % (end - begin));
+          if (ret) {
+            ASSERT_EQ(static_cast<uint32_t>(ret.value()), 1) << "[Read: returned value]";
+            ++hits;
+          }
+          ++reads;
+          CountOperation();
+        }
+        read_num += reads;
+        hit_num += hits;
+      }
+      index_->TearDown();
+    };
+
+    const auto heap_base = GetHeapUsage();
+    Preprocess(kSequential);
+    memory_sampler_ = [&]() -> size_t { return GetIndexMemoryUsage<Index>(*index_, heap_base); };
+
+    std::thread sampler{[&] {
+      // sample memory when the first writer appends each window's worth of keys
+      for (size_t next = kKeysPerWindow;;) {
+        const auto is_finished = finished_num.load() == kWriterNum || HasFailure();
+        for (; first_appended.load(std::memory_order_relaxed) >= next; next += kKeysPerWindow) {
+          window_mems.emplace_back(memory_sampler_());
+        }
+        if (is_finished) break;
+        std::this_thread::sleep_for(std::chrono::microseconds{kSamplingInterval});
+      }
+    }};
+
+    std::cout << "  [dbgroup] sliding window (" << kWindowSize << " keys)...\n";
+    const auto begin = GetTimestamp();
+    RunMT(mt_worker);
+    const auto sec = static_cast<double>(GetTimestamp() - begin) / 1e9;
+    sampler.join();
+    const auto mem = memory_sampler_();
+    memory_sampler_ = nullptr;
+    if (HasFailure()) return;
+
+    size_t append_num = 0;
+    size_t live_expected = 0;
+    for (const auto cnt : append_nums) {
+      append_num += cnt;
+      live_expected += std::min(cnt, kKeysPerWindow);
+    }
+    const auto ops = append_num + read_num.load();
+    std::cout << "  [dbgroup] " << append_num << " appends, " << read_num << " reads ("
+              << (read_num > 0 ? hit_num * 100 / read_num : 0) << "% hits), "
+              << static_cast<size_t>(static_cast<double>(ops) / sec) << " ops/s, " << mem
+              << " bytes in the end\n";
+    std::cout << "  [dbgroup] memory per window [KiB]:";
+    for (const auto window_mem : window_mems) {
+      std::cout << ' ' << window_mem / 1024;
+    }
+    std::cout << '\n';
+
+    // only the last keys of each writer remain
+    if constexpr (HasRead<Index, Key, Payload>()) {
+      size_t live_num = 0;
+      index_->SetUp();
+      for (size_t id = 0; id < kExecNum && !HasFailure(); ++id) {
+        const auto& ret = index_->Read(id);
+        if (!ret) continue;
+        const auto cnt = append_nums[id % kWriterNum];
+        const auto pos = id / kWriterNum;
+        EXPECT_TRUE(pos < cnt && cnt - pos <= kKeysPerWindow) << "[Read: deleted key]";
+        ++live_num;
+      }
+      index_->TearDown();
+      ASSERT_EQ(live_num, live_expected) << "[Read: # of live keys]";
+    }
+  }
+
+  /**
+   * @brief Measure throughput under contention on a few hot keys.
+   *
+   * All the active workers upsert/update `kHotKeyNum` keys with record merging,
+   * and the number of active workers doubles up to `kThreadNum`. This function
+   * reports throughput, fairness among workers (i.e., Jain's index), and retries
+   * per operation (if supported) for each number of workers. It also reports
+   * throughput collapse, i.e., throughput less than half of the peak with fewer
+   * workers. Finally, the merged values must match the number of operations.
+   *
+   * @param write_ops A write operation for hot keys.
+   */
+  void
+  MeasureHotKeyContentionWith(  //
+      const WriteOperation write_ops)
+  {
+    constexpr size_t kMaxHotKeyNum = 64;
+    constexpr double kCollapseRatio = 0.5;
+    static_assert(  //
+        kHotKeyNum >= 1 && kHotKeyNum <= kMaxHotKeyNum,
+        "1 <= DBGROUP_TEST_HOT_KEY_NUM <= 64.");
+
+    if (kPhaseDuration == 0 || kDisableRecordMerging                                   //
+        || !HasRead<Index, Key, Payload>()                                             //
+        || (write_ops != kUpsert && write_ops != kUpdate)                              //
+        || (write_ops == kUpsert && !HasUpsert<Index, Key, Payload>())                 //
+        || (write_ops == kUpdate && !HasUpdate<Index, Key, Payload>())                 //
+        || (!HasWrite<Index, Key, Payload>() && !HasInsert<Index, Key, Payload>()))  //
+    {
+      GTEST_SKIP();
+    }
+
+    // use adjacent keys to make them contend in the same node as well
+    const std::vector<size_t> hot_ids{forward.begin(),
+                                      forward.begin() + std::min(kHotKeyNum, forward.size())};
+    std::vector<size_t> thread_nums{};
+    for (size_t n = 1; n < kThreadNum; n *= 2) {
+      thread_nums.emplace_back(n);
+    }
+    thread_nums.emplace_back(kThreadNum);
+
+    size_t active_num{};
+    std::vector<size_t> measured_ops(kThreadNum);
+    std::atomic_size_t total_ops{};
+
+    auto mt_worker = [&](const size_t w_id) -> void {
+      PrepareTargetIDs();
+      if (w_id >= active_num) return;
+
+      std::mt19937_64 rand_engine{w_id};
+      size_t ops = 0;
+      index_->SetUp();
+      while (KeepRunning()) {
+        const auto id = hot_ids[rand_engine() % hot_ids.size()];
+        if (write_ops == kUpsert) {
+          index_->Upsert(id);
+        } else {
+          ASSERT_TRUE(index_->Update(id)) << "[Update: RC]";
+        }
+        ++ops;
+        CountOperation();
+        if (HasFailure()) break;
+      }
+      index_->TearDown();
+      measured_ops[w_id] = measured_counter->Load();
+      total_ops += ops;
+    };
+
+    std::cout << "  [dbgroup] " << hot_ids.size() << " hot key(s)...\n";
+    double peak = 0;
+    size_t peak_num = 0;
+    for (const auto n : thread_nums) {
+      active_num = n;
+      total_ops = 0;
+      std::fill(measured_ops.begin(), measured_ops.end(), 0);
+
+      Preprocess(kSequential);
+      index_->SetUp();
+      if (write_ops == kUpdate) {
+        for (const auto id : hot_ids) {
+          if constexpr (HasWrite<Index, Key, Payload>()) {
+            index_->Write(id);
+          } else {
+            index_->Insert(id);
+          }
+        }
+      }
+      const auto retries_begin = index_->GetRetryCount();
+      index_->TearDown();
+
+      std::cout << "  [dbgroup] " << n << " worker(s)...\n";
+      RunMT(mt_worker, kTimeBounded);
+      if (HasFailure()) return;
+
+      // compute Jain's fairness index over the active workers
+      double sum = 0;
+      double sq_sum = 0;
+      const auto [min_it, max_it] = std::minmax_element(measured_ops.begin(),  //
+                                                        measured_ops.begin() + n);
+      for (size_t i = 0; i < n; ++i) {
+        const auto ops = static_cast<double>(measured_ops[i]);
+        sum += ops;
+        sq_sum += ops * ops;
+      }
+      const auto fairness = (sq_sum > 0) ? sum * sum / (n * sq_sum) : 0.0;
+      const auto min_max = (*max_it > 0) ? static_cast<double>(*min_it) / *max_it : 0.0;
+      std::cout << "  [dbgroup] fairness: " << fairness << " (min/max: " << min_max << ")";
+
+      index_->SetUp();
+      const auto retries_end = index_->GetRetryCount();
+      if (retries_begin && retries_end && total_ops > 0) {
+        const auto retries = static_cast<double>(*retries_end - *retries_begin) / total_ops;
+        std::cout << ", retries: " << retries << " per op";
+      }
+      std::cout << "\n";
+
+      const auto throughput = sum * 1e9 / static_cast<double>(measure_end_ - measure_begin_);
+      if (throughput > peak) {
+        peak = throughput;
+        peak_num = n;
+      } else if (throughput < peak * kCollapseRatio) {
+        std::cout << "  [dbgroup] throughput collapse: " << static_cast<size_t>(throughput)
+                  << " ops/s with " << n << " workers (peak: " << static_cast<size_t>(peak)
+                  << " ops/s with " << peak_num << " workers)\n";
+      }
+
+      // merged values must include every operation
+      size_t val_sum = 0;
+      for (const auto id : hot_ids) {
+        const auto& ret = index_->Read(id);
+        if (ret) {
+          val_sum += static_cast<size_t>(ret.value());
+        }
+      }
+      index_->TearDown();
+      const auto init_sum = (write_ops == kUpdate) ? hot_ids.size() : 0;
+      ASSERT_EQ(val_sum, init_sum + total_ops) << "[Read: merged values]";
+    }
+  }
+
+  /**
+   * @brief Increment hot keys with compare-and-swap retry loops.
+   *
+   * The number of active workers doubles up to `kThreadNum`, and they perform
+   * `kExecNum` increments in total on `kHotKeyNum` keys. Each worker caches the
+   * last payload observed for each key and retries with the payload returned
+   * by a failed swap. This function reports throughput and failed swaps per
+   * increment for each number of workers, and the final payloads must match
+   * the number of increments exactly.
+   */
+  void
+  MeasureCompareAndSwapIncrements()
+  {
+    if (!HasCompareAndSwap<Index, Key, Payload>()                                    //
+        || !HasRead<Index, Key, Payload>()                                           //
+        || (!HasWrite<Index, Key, Payload>() && !HasInsert<Index, Key, Payload>()))  //
+    {
+      GTEST_SKIP();
+    }
+
+    const std::vector<size_t> hot_ids{forward.begin(),
+                                      forward.begin() + std::min(kHotKeyNum, forward.size())};
+    std::vector<size_t> thread_nums{};
+    for (size_t n = 1; n < kThreadNum; n *= 2) {
+      thread_nums.emplace_back(n);
+    }
+    thread_nums.emplace_back(kThreadNum);
+
+    size_t active_num{};
+    std::atomic_size_t total_retries{};
+
+    auto mt_worker = [&](const size_t w_id) -> void {
+      PrepareTargetIDs();
+      if (w_id >= active_num) return;
+
+      std::mt19937_64 rand_engine{w_id};
+      std::vector<Payload> cached(hot_ids.size(), 1);
+      size_t retries = 0;
+      index_->SetUp();
+      for (size_t i = w_id; i < kExecNum && !HasFailure(); i += active_num) {
+        const auto pos = rand_engine() % hot_ids.size();
+        auto& expected = cached[pos];
+        while (true) {
+          const auto& ret = index_->CompareAndSwap(hot_ids[pos], expected, expected + 1);
+          ASSERT_TRUE(ret) << "[CompareAndSwap: RC]";
+          if (ret.value() == expected) break;
+          expected = ret.value();
+          ++retries;
+        }
+        ++expected;
+        CountOperation();
+      }
+      index_->TearDown();
+      total_retries += retries;
+    };
+
+    std::cout << "  [dbgroup] " << hot_ids.size() << " hot key(s)...\n";
+    std::cout << "  [dbgroup] " << std::setw(8) << "workers" << std::setw(14) << "ops/s"
+              << std::setw(18) << "retries per op" << '\n';
+    for (const auto n : thread_nums) {
+      active_num = n;
+      total_retries = 0;
+
+      Preprocess(kSequential);
+      index_->SetUp();
+      for (const auto id : hot_ids) {
+        if constexpr (HasWrite<Index, Key, Payload>()) {
+          index_->Write(id);
+        } else {
+          index_->Insert(id);
+        }
+      }
+      index_->TearDown();
+
+      const auto begin = GetTimestamp();
+      RunMT(mt_worker);
+      const auto sec = static_cast<double>(GetTimestamp() - begin) / 1e9;
+      if (HasFailure()) return;
+
+      const auto retries = static_cast<double>(total_retries.load()) / kExecNum;
+      std::cout << "  [dbgroup] " << std::setw(8) << n << std::setw(14)
+                << static_cast<size_t>(kExecNum / sec) << std::setw(18) << retries << '\n';
+
+      // every increment must be applied exactly once
+      size_t val_sum = 0;
+      index_->SetUp();
+      for (const auto id : hot_ids) {
+        const auto& ret = index_->Read(id);
+        ASSERT_TRUE(ret) << "[Read: RC]";
+        val_sum += static_cast<size_t>(ret.value());
+      }
+      index_->TearDown();
+      ASSERT_EQ(val_sum, hot_ids.size() + kExecNum) << "[Read: incremented values]";
     }
   }
 
@@ -696,6 +1419,248 @@ class IndexMultiThreadFixture : public testing::Test
     VerifyScanBackward(expect_success, expected_val);
   }
 
+  /**
+   * @brief Run mixed operations concurrently just after bulkloading.
+   *
+   * This function bulkloads keys except for gap ones, and then writers insert
+   * the gap keys while readers and scanners access the bulkloaded ones. Since
+   * the gap keys interleave with densely packed leaves, this workload causes a
+   * burst of splits. Insert throughput is reported per tenth of the gap keys to
+   * show how it recovers from the burst.
+   */
+  void
+  MeasureBulkloadThenIngest()
+  {
+    constexpr size_t kPhaseNum = 10;
+    constexpr size_t kWriterNum = std::max<size_t>(kThreadNum / 2, 1);
+    constexpr size_t kScanThread = kWriterNum + (kThreadNum - kWriterNum + 1) / 2;
+    constexpr auto kTraceSMOs = HasSMOHandler<Index>();
+
+    if (!HasBulkload<Index, Key, Payload>() || !HasRead<Index, Key, Payload>()       //
+        || (!HasWrite<Index, Key, Payload>() && !HasInsert<Index, Key, Payload>()))  //
+    {
+      GTEST_SKIP();
+    }
+
+    std::vector<size_t> gap_ids{};
+    for (const auto id : random) {
+      if (IsGapKey(id)) {
+        gap_ids.emplace_back(id);
+      }
+    }
+
+    LatencyRecorder latency{kThreadNum};
+    std::atomic_size_t finished_num{0};
+    std::atomic_size_t read_num{0};
+    std::atomic_size_t scan_num{0};
+
+    auto mt_worker = [&](const size_t w_id) -> void {
+      PrepareTargetIDs();
+      index_->SetUp();
+      if (w_id < kWriterNum) {
+        latency.Reserve(w_id, gap_ids.size() / kWriterNum + 1);
+        for (size_t i = w_id; i < gap_ids.size(); i += kWriterNum) {
+          const auto begin = GetTimestamp();
+          if constexpr (HasInsert<Index, Key, Payload>()) {
+            ASSERT_FALSE(index_->Insert(gap_ids[i])) << "[Insert: RC]";
+          } else {
+            index_->Write(gap_ids[i]);
+          }
+          latency.Record(w_id, begin, GetTimestamp());
+          CountOperation();
+          if (HasFailure()) break;
+        }
+        ++finished_num;
+      } else if (w_id < kScanThread || !HasScan<Index, Key, Payload>()) {
+        size_t cnt = 0;
+        while (finished_num < kWriterNum && !HasFailure()) {
+          const auto id = GetID();
+          const auto& ret = index_->Read(id);
+          if (!IsGapKey(id)) {
+            ASSERT_TRUE(ret) << "[Read: bulkloaded key]";
+          }
+          if (ret) {
+            ASSERT_EQ(static_cast<uint32_t>(ret.value()), 1) << "[Read: returned value]";
+          }
+          ++cnt;
+          CountOperation();
+        }
+        read_num += cnt;
+      } else {
+        size_t cnt = 0;
+        while (finished_num < kWriterNum && !HasFailure()) {
+          // bulkloaded keys in a range must be visible during splits
+          const auto b_id = GetID();
+          const auto e_id = std::min(b_id + kScanSize, kExecNum);
+          size_t present_num = 0;
+          for (auto id = b_id; id < e_id; ++id) {
+            present_num += IsGapKey(id) ? 0 : 1;
+          }
+          size_t rec_num = 0;
+          for (auto&& iter = index_->Scan(b_id, kClosed, e_id, kOpen); iter; ++iter) {
+            const auto& [key, payload] = *iter;
+            ASSERT_EQ(payload, 1) << "[Scan: payload]";
+            ++rec_num;
+          }
+          ASSERT_GE(rec_num, present_num) << "[Scan: # of records]";
+          ASSERT_LE(rec_num, e_id - b_id) << "[Scan: # of records]";
+          ++cnt;
+          CountOperation();
+        }
+        scan_num += cnt;
+      }
+      index_->TearDown();
+    };
+
+    Preprocess(kRandom);
+    std::cout << "  [dbgroup] bulkload keys with gaps...\n";
+    index_->Bulkload(kOddGaps);
+    if constexpr (kTraceSMOs) {
+      smo_recorder_.Clear();
+      index_->SetSMOHandler([&](const SMOType type) { smo_recorder_.Record(type); });
+    }
+
+    std::cout << "  [dbgroup] insert gap keys with reads/scans...\n";
+    const auto begin = GetTimestamp();
+    RunMT(mt_worker);
+    const auto sec = static_cast<double>(GetTimestamp() - begin) / 1e9;
+    if (HasFailure()) return;
+
+    std::cout << "  [dbgroup] " << gap_ids.size() << " inserts in " << sec * 1000 << " ms, "
+              << static_cast<size_t>(read_num / sec) << " reads/s, "
+              << static_cast<size_t>(scan_num / sec) << " scans/s\n";
+    if constexpr (kTraceSMOs) {
+      smo_recorder_.Report(latency);
+    }
+
+    // compute insert throughput in each tenth of the inserted gap keys
+    auto&& samples = latency.GetSamples();
+    std::sort(samples.begin(), samples.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.end < rhs.end; });
+    std::cout << "  [dbgroup] insert throughput per 10% of gap keys [ops/s]:";
+    auto prev_end = begin;
+    for (size_t i = 1; i <= kPhaseNum && !samples.empty(); ++i) {
+      std::cout << (i > 1 ? ", " : " ");
+      const auto prev_pos = samples.size() * (i - 1) / kPhaseNum;
+      const auto pos = samples.size() * i / kPhaseNum;
+      if (pos == prev_pos) {  // fewer samples than tenths
+        std::cout << "-";
+        continue;
+      }
+
+      const auto end = samples[pos - 1].end;
+      const auto ops = static_cast<double>(pos - prev_pos);
+      const auto ns = static_cast<double>(std::max<uint64_t>(end - prev_end, 1));
+      std::cout << static_cast<size_t>(ops * 1e9 / ns);
+      prev_end = end;
+    }
+    std::cout << "\n";
+
+    VerifyRead(kExpectSuccess, 1);
+    VerifyScanForward(kExpectSuccess, 1);
+  }
+
+  /**
+   * @brief Run reads and scans concurrently with an in-progress bulkload.
+   *
+   * The first worker bulkloads all the keys with the half of threads, and the
+   * others read random keys or repeatedly scan a fixed range until the build
+   * finishes. Readers must see either no record or a bulkloaded one, and each
+   * scanner must see a sorted subset of the range that never shrinks. This
+   * function reports reader throughput and latency during the build.
+   */
+  void
+  MeasureReadsDuringBulkload()
+  {
+    constexpr size_t kLoaderNum = std::max<size_t>(kThreadNum / 2, 1);
+    constexpr size_t kScanThread = (kThreadNum + 1) / 2;
+
+    if (!HasBulkload<Index, Key, Payload>() || !HasOnlineBulkload<Index>()  //
+        || !HasRead<Index, Key, Payload>() || kThreadNum < 2)               //
+    {
+      GTEST_SKIP();
+    }
+
+    LatencyRecorder read_latency{kThreadNum};
+    LatencyRecorder scan_latency{kThreadNum};
+    std::atomic_bool is_loaded{false};
+    std::atomic_size_t hit_num{0};
+    uint64_t build_ns{};
+
+    auto mt_worker = [&](const size_t w_id) -> void {
+      PrepareTargetIDs();
+      index_->SetUp();
+      if (w_id == 0) {
+        const auto begin = GetTimestamp();
+        index_->Bulkload(BulkloadInput<Key, Payload>{keys, kExecNum}, kLoaderNum);
+        build_ns = GetTimestamp() - begin;
+        is_loaded = true;
+      } else if (w_id < kScanThread || !HasScan<Index, Key, Payload>()) {
+        size_t cnt = 0;
+        while (!is_loaded && !HasFailure()) {
+          const auto begin = GetTimestamp();
+          const auto& ret = index_->Read(GetID());
+          read_latency.Record(w_id, begin, GetTimestamp());
+          CountOperation();
+          if (ret) {
+            ASSERT_EQ(static_cast<uint32_t>(ret.value()), 1) << "[Read: returned value]";
+            ++cnt;
+          }
+        }
+        hit_num += cnt;
+      } else {
+        // bulkloaded records in a fixed range must not disappear
+        const auto b_id = GetID();
+        const auto e_id = std::min(b_id + kScanSize, kExecNum);
+        size_t prev_num = 0;
+        while (!is_loaded && !HasFailure()) {
+          const auto begin = GetTimestamp();
+          auto id = b_id;
+          size_t rec_num = 0;
+          for (auto&& iter = index_->Scan(b_id, kClosed, e_id, kOpen); iter; ++iter, ++id) {
+            const auto& [key, payload] = *iter;
+            while (id < e_id && !Equal<Comp>(key, keys[id])) {
+              ++id;
+            }
+            ASSERT_LT(id, e_id) << "[Scan: key order]";
+            ASSERT_EQ(payload, 1) << "[Scan: payload]";
+            ++rec_num;
+          }
+          scan_latency.Record(w_id, begin, GetTimestamp());
+          CountOperation();
+          ASSERT_GE(rec_num, prev_num) << "[Scan: # of records]";
+          prev_num = rec_num;
+        }
+      }
+      index_->TearDown();
+    };
+
+    Preprocess(kRandom);
+    std::cout << "  [dbgroup] bulkload with concurrent reads/scans...\n";
+    RunMT(mt_worker);
+    if (HasFailure()) return;
+
+    const auto sec = static_cast<double>(std::max<uint64_t>(build_ns, 1)) / 1e9;
+    auto&& read_lats = read_latency.GetLatencies();
+    auto&& scan_lats = scan_latency.GetLatencies();
+    const auto hit_ratio = 100.0 * hit_num / std::max<size_t>(read_lats.size(), 1);
+    std::cout << "  [dbgroup] " << kExecNum << " records in " << sec * 1000 << " ms with "
+              << kLoaderNum << " thread(s)\n"
+              << "  [dbgroup] reads during bulkload: "
+              << static_cast<size_t>(read_lats.size() / sec) << " ops/s (" << hit_ratio
+              << "% hits), p50 " << GetQuantile(read_lats, 0.5) << " ns, p99 "
+              << GetQuantile(read_lats, 0.99) << " ns\n";
+    if constexpr (HasScan<Index, Key, Payload>()) {
+      std::cout << "  [dbgroup] scans during bulkload: "
+                << static_cast<size_t>(scan_lats.size() / sec) << " ops/s, p50 "
+                << GetQuantile(scan_lats, 0.5) << " ns, p99 " << GetQuantile(scan_lats, 0.99)
+                << " ns\n";
+    }
+
+    VerifyRead(kExpectSuccess, 1);
+    VerifyScanForward(kExpectSuccess, 1);
+  }
+
   /*##########################################################################*
    * Static member variables
    *##########################################################################*/
@@ -721,6 +1686,15 @@ class IndexMultiThreadFixture : public testing::Test
   /// @brief The number of executions.
   static thread_local inline size_t exec_num;
 
+  /// @brief A counter for sampling throughput (if enabled).
+  static thread_local inline OpCounter* op_counter;
+
+  /// @brief A counter of operations in the measurement phase.
+  static thread_local inline OpCounter* measured_counter;
+
+  /// @brief A counter of executed operations in a count-based execution.
+  static thread_local inline OpCounter* executed_counter;
+
   /*##########################################################################*
    * Internal member variables
    *##########################################################################*/
@@ -736,6 +1710,39 @@ class IndexMultiThreadFixture : public testing::Test
 
   /// @brief An access pattern for testing.
   AccessPattern pattern_{};
+
+  /// @brief SMOs reported by the index.
+  SMORecorder smo_recorder_{};
+
+  /// @brief A sampler of throughput during each phase (if enabled).
+  std::unique_ptr<ThroughputTimeline> timeline_{};
+
+  /// @brief An optional function for sampling memory with throughput.
+  std::function<size_t()> memory_sampler_{};
+
+  /// @brief The number of operations counted by the last timeline.
+  size_t timeline_ops_{};
+
+  /// @brief A flag for the current execution bounded by time.
+  bool time_bounded_{false};
+
+  /// @brief The current phase of a time-bounded execution.
+  std::atomic<Phase> phase_{kWarmup};
+
+  /// @brief Per-worker counters of measured (or count-based executed) operations.
+  std::vector<OpCounter> measured_ = std::vector<OpCounter>(kThreadNum);
+
+  /// @brief The beginning time of the measurement phase.
+  uint64_t measure_begin_{};
+
+  /// @brief The end time of the measurement phase.
+  uint64_t measure_end_{};
+
+  /// @brief The number of round trips at the beginning of measurement.
+  size_t round_trips_begin_{};
+
+  /// @brief The number of round trips at the end of measurement.
+  size_t round_trips_end_{};
 };
 
 }  // namespace dbgroup::index::test
@@ -252,10 +252,86 @@ TYPED_TEST(IndexMultiThreadFixture, ConcurrentMixedOperationsSucceed)
   TestFixture::VerifyConcurrentSMOs();
 }
 
+/*----------------------------------------------------------------------------*
+ * Throughput timeline
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(IndexMultiThreadFixture, TimelineCountsOnlyExecutedOperations)
+{
+  TestFixture::VerifyTimelineCounts();
+}
+
+/*----------------------------------------------------------------------------*
+ * Time-bounded throughput measurements
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(IndexMultiThreadFixture, MeasureRandomReadThroughput)
+{
+  TestFixture::MeasureThroughputWith(kWithoutWrite, kRandom);
+}
+
+TYPED_TEST(IndexMultiThreadFixture, MeasureRandomWriteThroughput)
+{
+  TestFixture::MeasureThroughputWith(kWrite, kRandom);
+}
+
+TYPED_TEST(IndexMultiThreadFixture, MeasureRandomUpsertThroughput)
+{
+  TestFixture::MeasureThroughputWith(kUpsert, kRandom);
+}
+
+TYPED_TEST(IndexMultiThreadFixture, MeasureRandomUpdateThroughput)
+{
+  TestFixture::MeasureThroughputWith(kUpdate, kRandom);
+}
+
+TYPED_TEST(IndexMultiThreadFixture, MeasureRandomReadThroughputWithMisses)
+{
+  TestFixture::MeasureReadWithMisses(kOddGaps);
+}
+
+/*----------------------------------------------------------------------------*
+ * Contention workloads
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(IndexMultiThreadFixture, UpsertHotKeysWithMerging)
+{
+  TestFixture::MeasureHotKeyContentionWith(kUpsert);
+}
+
+TYPED_TEST(IndexMultiThreadFixture, UpdateHotKeysWithMerging)
+{
+  TestFixture::MeasureHotKeyContentionWith(kUpdate);
+}
+
+TYPED_TEST(IndexMultiThreadFixture, IncrementHotKeysWithCompareAndSwap)
+{
+  TestFixture::MeasureCompareAndSwapIncrements();
+}
+
+/*----------------------------------------------------------------------------*
+ * Time-series workloads
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(IndexMultiThreadFixture, SlidingWindowWithConcurrentReads)
+{
+  TestFixture::MeasureSlidingWindow();
+}
+
 /*----------------------------------------------------------------------------*
  * Bulkload operation
  *----------------------------------------------------------------------------*/
 
+TYPED_TEST(IndexMultiThreadFixture, BulkloadThenIngestGapKeysWithReadsAndScans)
+{
+  TestFixture::MeasureBulkloadThenIngest();
+}
+
+TYPED_TEST(IndexMultiThreadFixture, ReadAndScanDuringBulkload)
+{
+  TestFixture::MeasureReadsDuringBulkload();
+}
+
 TYPED_TEST(IndexMultiThreadFixture, BulkloadWithoutAdditionalWriteOperations)
 {
   TestFixture::VerifyBulkloadWith(kWithoutWrite, kSequential);
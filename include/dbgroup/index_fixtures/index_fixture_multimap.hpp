@@ -0,0 +1,477 @@
+/*
+ * Copyright 2026 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_INDEX_FIXTURES_INDEX_FIXTURE_MULTIMAP_HPP
+#define DBGROUP_INDEX_FIXTURES_INDEX_FIXTURE_MULTIMAP_HPP
+
+// C++ standard libraries
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// external libraries
+#include <gtest/gtest.h>
+
+// external C++ libraries
+#include <dbgroup/index/concepts.hpp>
+#include <dbgroup/index/utility.hpp>
+
+// local sources
+#include "common.hpp"
+#include "concepts.hpp"
+#include "index_wrapper.hpp"
+#include "metrics.hpp"
+
+namespace dbgroup::index::test
+{
+/*############################################################################*
+ * Fixture class definition
+ *############################################################################*/
+
+/**
+ * @brief A fixture for non-unique (secondary) indexes.
+ *
+ * Each key has a run of duplicates whose payloads are `0, 1, ..., d - 1`, where
+ * the number of duplicates `d` is uniform or Zipf-distributed over keys (see
+ * `DuplicatePattern`). Target indexes must declare `kAllowDuplicates`.
+ *
+ * @tparam IndexInfo A class for specifying a target index.
+ */
+template <class IndexInfo>
+class MultiMapIndexFixture : public ::testing::Test
+{
+  /*##########################################################################*
+   * Type aliases
+   *##########################################################################*/
+
+  using Key = typename IndexInfo::Key::Data;
+  using Payload = typename IndexInfo::Payload::Data;
+  using Comp = typename IndexInfo::Key::Comp;
+  using Index = typename IndexInfo::Index;
+  using IndexWrapper_t = IndexWrapper<IndexInfo>;
+  using Pair = std::pair<size_t, uint32_t>;
+
+ protected:
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  static constexpr size_t kAvgDuplicateNum = 16;
+  static constexpr size_t kKeyNum = kExecNum / kAvgDuplicateNum;
+  static constexpr double kZipfSkew = 1.0;
+  static constexpr size_t kSampledScanNum = 100;
+  static constexpr size_t kSampledScanStep = std::max<size_t>(kKeyNum / kSampledScanNum, 1);
+  static constexpr std::array<size_t, 4> kRunBounds = {1, 2, 16, 256};
+
+  /*##########################################################################*
+   * Setup/Teardown
+   *##########################################################################*/
+
+  static void
+  SetUpTestSuite()
+  {
+    keys = PrepareTestData<Key>(kKeyNum + 1);
+  }
+
+  static void
+  TearDownTestSuite()
+  {
+    ReleaseTestData(keys);
+  }
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+    if (index_) {
+      index_->TearDown();
+      index_ = nullptr;
+    }
+  }
+
+  /*##########################################################################*
+   * Utility functions
+   *##########################################################################*/
+
+  /**
+   * @brief Prepare duplicate counts and construct an empty index.
+   *
+   * @param pattern A distribution of duplicate counts.
+   */
+  void
+  Preprocess(  //
+      const DuplicatePattern pattern)
+  {
+    std::mt19937_64 rand_engine{kRandomSeed};
+    dup_nums_.assign(kKeyNum, kAvgDuplicateNum);
+    if (pattern == kSkewedDuplicates) {
+      // assign Zipf-distributed counts to keys in random order
+      double total = 0;
+      for (size_t r = 1; r <= kKeyNum; ++r) {
+        total += 1.0 / std::pow(r, kZipfSkew);
+      }
+      std::vector<size_t> ranks(kKeyNum);
+      for (size_t i = 0; i < kKeyNum; ++i) {
+        ranks[i] = i;
+      }
+      std::shuffle(ranks.begin(), ranks.end(), rand_engine);
+      for (size_t r = 0; r < kKeyNum; ++r) {
+        const auto num = std::round(kExecNum / std::pow(r + 1, kZipfSkew) / total);
+        dup_nums_[ranks[r]] = std::max<size_t>(static_cast<size_t>(num), 1);
+      }
+    }
+
+    pairs_.clear();
+    for (size_t id = 0; id < kKeyNum; ++id) {
+      for (uint32_t val = 0; val < dup_nums_[id]; ++val) {
+        pairs_.emplace_back(id, val);
+      }
+    }
+    std::shuffle(pairs_.begin(), pairs_.end(), rand_engine);
+
+    index_ = std::make_unique<IndexWrapper_t>(keys);
+    index_->SetUp();
+  }
+
+  /**
+   * @param id The ID of a key.
+   * @param odd_only A flag for expecting only odd payloads.
+   * @return The number of expected duplicates of the given key.
+   */
+  [[nodiscard]] auto
+  GetExpectedNum(  //
+      const size_t id,
+      const bool odd_only) const  //
+      -> size_t
+  {
+    return odd_only ? dup_nums_[id] / 2 : dup_nums_[id];
+  }
+
+  /*##########################################################################*
+   * Functions for verification
+   *##########################################################################*/
+
+  void
+  VerifyInsert()
+  {
+    for (const auto& [id, val] : pairs_) {
+      ASSERT_FALSE(index_->Insert(id, val)) << "[Insert: RC]";
+    }
+  }
+
+  void
+  VerifyPairDelete()
+  {
+    for (const auto& [id, val] : pairs_) {
+      if (val % 2 != 0) continue;
+      ASSERT_TRUE(index_->Delete(id, val)) << "[Delete: RC]";
+    }
+    for (const auto& [id, val] : pairs_) {
+      if (val % 2 != 0) continue;
+      ASSERT_FALSE(index_->Delete(id, val)) << "[Delete: deleted pair]";
+    }
+    for (size_t id = 0; id < kKeyNum; ++id) {
+      const auto val = static_cast<uint32_t>(dup_nums_[id]);
+      ASSERT_FALSE(index_->Delete(id, val)) << "[Delete: absent pair]";
+    }
+  }
+
+  /**
+   * @brief Verify the duplicate run of each key with a point scan.
+   *
+   * @param odd_only A flag for expecting only odd payloads.
+   */
+  void
+  VerifyDuplicateRuns(  //
+      const bool odd_only)
+  {
+    std::vector<uint32_t> vals{};
+    for (size_t id = 0; id < kKeyNum; ++id) {
+      vals.clear();
+      for (auto&& iter = index_->Scan(id, kClosed, id, kClosed); iter; ++iter) {
+        const auto& [key, payload] = *iter;
+        ASSERT_TRUE(Equal<Comp>(key, keys[id])) << "[Scan: key]";
+        vals.emplace_back(static_cast<uint32_t>(payload));
+      }
+      std::sort(vals.begin(), vals.end());
+
+      const auto num = GetExpectedNum(id, odd_only);
+      ASSERT_EQ(vals.size(), num) << "[Scan: # of duplicates]";
+      for (size_t i = 0; i < num; ++i) {
+        ASSERT_EQ(vals[i], odd_only ? 2 * i + 1 : i) << "[Scan: payload]";
+      }
+
+      if constexpr (HasRead<Index, Key, Payload>()) {
+        const auto& ret = index_->Read(id);
+        if (num == 0) {
+          ASSERT_FALSE(ret) << "[Read: RC]";
+        } else {
+          ASSERT_TRUE(ret) << "[Read: RC]";
+          const auto val = static_cast<uint32_t>(ret.value());
+          ASSERT_LT(val, dup_nums_[id]) << "[Read: returned value]";
+          if (odd_only) {
+            ASSERT_EQ(val % 2, 1) << "[Read: returned value]";
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Verify scans spanning duplicate runs.
+   *
+   * A full scan must return keys in ascending order with the expected number of
+   * duplicates, and a scan with open bounds must exclude the runs of both ends.
+   *
+   * @param odd_only A flag for expecting only odd payloads.
+   */
+  void
+  VerifyScanOverRuns(  //
+      const bool odd_only)
+  {
+    size_t id = 0;
+    size_t cnt = 0;
+    for (auto&& iter = index_->Scan(); iter; ++iter) {
+      const auto& [key, payload] = *iter;
+      while (id < kKeyNum && !Equal<Comp>(key, keys[id])) {
+        ASSERT_EQ(cnt, GetExpectedNum(id, odd_only)) << "[Scan: # of duplicates]";
+        ++id;
+        cnt = 0;
+      }
+      ASSERT_LT(id, kKeyNum) << "[Scan: key order]";
+      ++cnt;
+    }
+    for (; id < kKeyNum; ++id, cnt = 0) {
+      ASSERT_EQ(cnt, GetExpectedNum(id, odd_only)) << "[Scan: # of duplicates]";
+    }
+
+    for (size_t b_id = 0; b_id + 2 < kKeyNum; b_id += kSampledScanStep) {
+      size_t rec_num = 0;
+      for (auto&& iter = index_->Scan(b_id, kOpen, b_id + 2, kOpen); iter; ++iter) {
+        const auto& [key, payload] = *iter;
+        ASSERT_TRUE(Equal<Comp>(key, keys[b_id + 1])) << "[Scan: key]";
+        ++rec_num;
+      }
+      ASSERT_EQ(rec_num, GetExpectedNum(b_id + 1, odd_only)) << "[Scan: # of duplicates]";
+    }
+  }
+
+  void
+  VerifyInsertWith(  //
+      const DuplicatePattern pattern)
+  {
+    if (!HasDuplicateKeys<Index>()            //
+        || !HasInsert<Index, Key, Payload>()  //
+        || !HasScan<Index, Key, Payload>())   //
+    {
+      GTEST_SKIP();
+    }
+
+    Preprocess(pattern);
+    VerifyInsert();
+    if (HasFailure()) return;
+    VerifyDuplicateRuns(false);
+    if (HasFailure()) return;
+    VerifyScanOverRuns(false);
+  }
+
+  void
+  VerifyPairDeleteWith(  //
+      const DuplicatePattern pattern)
+  {
+    if (!HasDuplicateKeys<Index>()                 //
+        || !HasInsert<Index, Key, Payload>()       //
+        || !HasScan<Index, Key, Payload>()         //
+        || !HasPairDelete<Index, Key, Payload>())  //
+    {
+      GTEST_SKIP();
+    }
+
+    Preprocess(pattern);
+    VerifyInsert();
+    if (HasFailure()) return;
+    VerifyPairDelete();
+    if (HasFailure()) return;
+    VerifyDuplicateRuns(true);
+    if (HasFailure()) return;
+    VerifyScanOverRuns(true);
+    if (HasFailure()) return;
+
+    // deleted pairs can be inserted again
+    for (const auto& [id, val] : pairs_) {
+      if (val % 2 != 0) continue;
+      ASSERT_FALSE(index_->Insert(id, val)) << "[Insert: RC]";
+    }
+    VerifyDuplicateRuns(false);
+  }
+
+  /**
+   * @brief Verify concurrent inserts and pair deletes on shared duplicate runs.
+   *
+   * @param pattern A distribution of duplicate counts.
+   */
+  void
+  VerifyConcurrentInsertAndDeleteWith(  //
+      const DuplicatePattern pattern)
+  {
+    if (!HasDuplicateKeys<Index>()                 //
+        || !HasInsert<Index, Key, Payload>()       //
+        || !HasScan<Index, Key, Payload>()         //
+        || !HasPairDelete<Index, Key, Payload>())  //
+    {
+      GTEST_SKIP();
+    }
+
+    Preprocess(pattern);
+    std::cout << "  [dbgroup] insert duplicates concurrently...\n";
+    index_->RunWorkers(kThreadNum, [&](const size_t w_id) {
+      for (size_t i = w_id; i < pairs_.size() && !HasFailure(); i += kThreadNum) {
+        const auto& [id, val] = pairs_[i];
+        ASSERT_FALSE(index_->Insert(id, val)) << "[Insert: RC]";
+      }
+    });
+    if (HasFailure()) return;
+    VerifyDuplicateRuns(false);
+    if (HasFailure()) return;
+
+    std::cout << "  [dbgroup] delete pairs concurrently...\n";
+    index_->RunWorkers(kThreadNum, [&](const size_t w_id) {
+      for (size_t i = w_id; i < pairs_.size() && !HasFailure(); i += kThreadNum) {
+        const auto& [id, val] = pairs_[i];
+        if (val % 2 != 0) continue;
+        ASSERT_TRUE(index_->Delete(id, val)) << "[Delete: RC]";
+      }
+    });
+    if (HasFailure()) return;
+    VerifyDuplicateRuns(true);
+  }
+
+  /*##########################################################################*
+   * Functions for performance measurements
+   *##########################################################################*/
+
+  /**
+   * @brief Measure inserts, scans over duplicate runs, and pair deletes.
+   *
+   * Scan throughput is reported for each class of run lengths since long runs
+   * span multiple leaves in B+trees and stress their scan paths.
+   *
+   * @param pattern A distribution of duplicate counts.
+   */
+  void
+  MeasureDuplicateScansWith(  //
+      const DuplicatePattern pattern)
+  {
+    if (!HasDuplicateKeys<Index>()            //
+        || !HasInsert<Index, Key, Payload>()  //
+        || !HasScan<Index, Key, Payload>())   //
+    {
+      GTEST_SKIP();
+    }
+
+    Preprocess(pattern);
+    auto begin = GetTimestamp();
+    VerifyInsert();
+    auto sec = static_cast<double>(GetTimestamp() - begin) / 1e9;
+    if (HasFailure()) return;
+    const auto max_dup =
+        dup_nums_.empty() ? 0 : *std::max_element(dup_nums_.begin(), dup_nums_.end());
+    std::cout << "  [dbgroup] insert: " << static_cast<size_t>(pairs_.size() / sec)
+              << " ops/s (max duplicates " << max_dup << ")\n";
+    if (const auto& node_num = index_->GetNodeCount(); node_num) {
+      std::cout << "  [dbgroup] nodes: " << *node_num;
+      if (const auto& fill = index_->GetFillFactor(); fill) {
+        std::cout << " (fill factor " << *fill << ")";
+      }
+      std::cout << "\n";
+    }
+
+    std::cout << "  [dbgroup] " << std::setw(12) << "run length" << std::setw(8) << "keys"
+              << std::setw(14) << "scans/s" << std::setw(14) << "records/s" << '\n';
+    for (size_t b = 0; b < kRunBounds.size(); ++b) {
+      const auto lo = kRunBounds[b];
+      const auto hi = (b + 1 < kRunBounds.size()) ? kRunBounds[b + 1] : SIZE_MAX;
+      size_t key_num = 0;
+      size_t rec_num = 0;
+      begin = GetTimestamp();
+      for (size_t id = 0; id < kKeyNum; ++id) {
+        if (dup_nums_[id] < lo || dup_nums_[id] >= hi) continue;
+        for (auto&& iter = index_->Scan(id, kClosed, id, kClosed); iter; ++iter) {
+          ++rec_num;
+        }
+        ++key_num;
+      }
+      sec = static_cast<double>(std::max<uint64_t>(GetTimestamp() - begin, 1)) / 1e9;
+      if (key_num == 0) continue;
+
+      const auto& label = (hi == SIZE_MAX) ? std::to_string(lo) + "+"
+                                           : std::to_string(lo) + "-" + std::to_string(hi - 1);
+      std::cout << "  [dbgroup] " << std::setw(12) << label << std::setw(8) << key_num
+                << std::setw(14) << static_cast<size_t>(key_num / sec) << std::setw(14)
+                << static_cast<size_t>(rec_num / sec) << '\n';
+    }
+
+    if constexpr (HasPairDelete<Index, Key, Payload>()) {
+      begin = GetTimestamp();
+      size_t del_num = 0;
+      for (const auto& [id, val] : pairs_) {
+        if (val % 2 != 0) continue;
+        ASSERT_TRUE(index_->Delete(id, val)) << "[Delete: RC]";
+        ++del_num;
+      }
+      sec = static_cast<double>(GetTimestamp() - begin) / 1e9;
+      std::cout << "  [dbgroup] pair delete: " << static_cast<size_t>(del_num / sec)
+                << " ops/s\n";
+    }
+  }
+
+  /*##########################################################################*
+   * Static member variables
+   *##########################################################################*/
+
+  /// @brief Actual keys.
+  static inline std::vector<Key> keys;
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief An index for testing.
+  std::unique_ptr<IndexWrapper_t> index_{};
+
+  /// @brief The number of duplicates per key.
+  std::vector<size_t> dup_nums_{};
+
+  /// @brief Pairs of key IDs and payloads in random order.
+  std::vector<Pair> pairs_{};
+};
+
+}  // namespace dbgroup::index::test
+
+#endif  // DBGROUP_INDEX_FIXTURES_INDEX_FIXTURE_MULTIMAP_HPP
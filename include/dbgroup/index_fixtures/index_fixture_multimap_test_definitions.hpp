@@ -0,0 +1,55 @@
+/*----------------------------------------------------------------------------*
+ * Insert operation
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(MultiMapIndexFixture, InsertWithUniformDuplicates)
+{
+  TestFixture::VerifyInsertWith(kUniformDuplicates);
+}
+
+TYPED_TEST(MultiMapIndexFixture, InsertWithSkewedDuplicates)
+{
+  TestFixture::VerifyInsertWith(kSkewedDuplicates);
+}
+
+/*----------------------------------------------------------------------------*
+ * Delete operation
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(MultiMapIndexFixture, PairDeleteWithUniformDuplicates)
+{
+  TestFixture::VerifyPairDeleteWith(kUniformDuplicates);
+}
+
+TYPED_TEST(MultiMapIndexFixture, PairDeleteWithSkewedDuplicates)
+{
+  TestFixture::VerifyPairDeleteWith(kSkewedDuplicates);
+}
+
+/*----------------------------------------------------------------------------*
+ * Concurrent operations
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(MultiMapIndexFixture, ConcurrentInsertAndDeleteWithUniformDuplicates)
+{
+  TestFixture::VerifyConcurrentInsertAndDeleteWith(kUniformDuplicates);
+}
+
+TYPED_TEST(MultiMapIndexFixture, ConcurrentInsertAndDeleteWithSkewedDuplicates)
+{
+  TestFixture::VerifyConcurrentInsertAndDeleteWith(kSkewedDuplicates);
+}
+
+/*----------------------------------------------------------------------------*
+ * Performance measurements
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(MultiMapIndexFixture, MeasureScansWithUniformDuplicates)
+{
+  TestFixture::MeasureDuplicateScansWith(kUniformDuplicates);
+}
+
+TYPED_TEST(MultiMapIndexFixture, MeasureScansWithSkewedDuplicates)
+{
+  TestFixture::MeasureDuplicateScansWith(kSkewedDuplicates);
+}
@@ -0,0 +1,475 @@
+/*
+ * Copyright 2026 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_INDEX_FIXTURES_INDEX_FIXTURE_SNAPSHOT_HPP
+#define DBGROUP_INDEX_FIXTURES_INDEX_FIXTURE_SNAPSHOT_HPP
+
+// C++ standard libraries
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <thread>
+#include <vector>
+
+// external libraries
+#include <gtest/gtest.h>
+
+// external C++ libraries
+#include <dbgroup/index/concepts.hpp>
+#include <dbgroup/index/utility.hpp>
+
+// local sources
+#include "common.hpp"
+#include "concepts.hpp"
+#include "index_wrapper.hpp"
+#include "metrics.hpp"
+
+namespace dbgroup::index::test
+{
+/*############################################################################*
+ * Fixture class definition
+ *############################################################################*/
+
+/**
+ * @brief A fixture for multi-version indexes that read pinned snapshots.
+ *
+ * Target indexes must support `GetSnapshot()`, `ReleaseSnapshot(uint64_t)`, and
+ * `ReadAt(const Key&, uint64_t, size_t)` (see `HasSnapshotRead`). Half of the
+ * threads write records and the others read snapshots in multi-thread tests.
+ *
+ * @tparam IndexInfo A class for specifying a target index.
+ */
+template <class IndexInfo>
+class SnapshotIndexFixture : public ::testing::Test
+{
+  /*##########################################################################*
+   * Type aliases
+   *##########################################################################*/
+
+  using Key = typename IndexInfo::Key::Data;
+  using Payload = typename IndexInfo::Payload::Data;
+  using Comp = typename IndexInfo::Key::Comp;
+  using Index = typename IndexInfo::Index;
+  using IndexWrapper_t = IndexWrapper<IndexInfo>;
+  using Clock_t = std::chrono::steady_clock;
+
+ protected:
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  static constexpr size_t kWriterNum = std::max<size_t>(kThreadNum / 2, 1);
+  static constexpr size_t kReaderNum = std::max<size_t>(kThreadNum - kWriterNum, 1);
+  static constexpr size_t kToggleKeyNum = std::min<size_t>(kExecNum, 4096);
+  static constexpr size_t kToggleRoundNum = 64;
+  static constexpr size_t kSampledReadNum = 64;
+  static constexpr size_t kHoldStepNum = 10;
+
+  /*##########################################################################*
+   * Setup/Teardown
+   *##########################################################################*/
+
+  static void
+  SetUpTestSuite()
+  {
+    keys = PrepareTestData<Key>(kExecNum + 1);
+  }
+
+  static void
+  TearDownTestSuite()
+  {
+    ReleaseTestData(keys);
+  }
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+    if (index_) {
+      index_->TearDown();
+      index_ = nullptr;
+    }
+  }
+
+  /*##########################################################################*
+   * Utility functions
+   *##########################################################################*/
+
+  /**
+   * @brief Construct an index and write the given number of keys.
+   *
+   * @param rec_num The number of keys to be written.
+   */
+  void
+  Preprocess(  //
+      const size_t rec_num)
+  {
+    index_ = std::make_unique<IndexWrapper_t>(keys);
+    index_->SetUp();
+    for (size_t id = 0; id < rec_num; ++id) {
+      index_->Write(id);
+    }
+  }
+
+  /**
+   * @brief Run writers and readers concurrently.
+   *
+   * @param write_func A function for each writer.
+   * @param read_func A function for each reader.
+   */
+  void
+  RunMT(  //
+      const std::function<void(size_t)>& write_func,
+      const std::function<void(size_t)>& read_func)
+  {
+    index_->RunWorkers(kWriterNum + kReaderNum, [&](const size_t i) {
+      if (i < kWriterNum) {
+        write_func(i);
+      } else {
+        read_func(i - kWriterNum);
+      }
+    });
+  }
+
+  /**
+   * @brief Verify a snapshot scan with expected payloads.
+   *
+   * @param snapshot A pinned snapshot.
+   * @param key_num The number of candidate keys.
+   * @param expected A function for computing the payload of each key visible to
+   * the snapshot.
+   */
+  void
+  VerifyScanAt(  //
+      const uint64_t snapshot,
+      const size_t key_num,
+      const std::function<std::optional<Payload>(size_t)>& expected)
+  {
+    if constexpr (HasSnapshotScan<Index, Key>()) {
+      size_t id = 0;
+      for (auto&& iter = index_->ScanAt(snapshot); iter; ++iter, ++id) {
+        while (id < key_num && !expected(id)) {
+          ++id;
+        }
+        ASSERT_LT(id, key_num) << "[ScanAt: phantom record]";
+
+        const auto& [key, payload] = *iter;
+        ASSERT_TRUE(Equal<Comp>(key, keys[id])) << "[ScanAt: key]";
+        ASSERT_EQ(payload, *expected(id)) << "[ScanAt: payload]";
+      }
+      for (; id < key_num; ++id) {
+        ASSERT_FALSE(expected(id)) << "[ScanAt: lost record]";
+      }
+    }
+  }
+
+  /*##########################################################################*
+   * Functions for verification
+   *##########################################################################*/
+
+  /**
+   * @brief Verify that old snapshots keep deleted and overwritten records.
+   *
+   * Payload `1` is written into all the keys, and then even keys are deleted
+   * and odd ones are re-inserted with payload `2`. An extra key is inserted
+   * last. Each snapshot must read the state when it is pinned.
+   */
+  void
+  VerifySnapshotVisibility()
+  {
+    if (!HasSnapshotRead<Index, Key>()         //
+        || !HasWrite<Index, Key, Payload>()    //
+        || !HasInsert<Index, Key, Payload>()   //
+        || !HasDelete<Index, Key, Payload>())  //
+    {
+      GTEST_SKIP();
+    }
+
+    Preprocess(kExecNum);
+    const auto old_snap = index_->GetSnapshot();
+    for (size_t id = 0; id < kExecNum; ++id) {
+      ASSERT_TRUE(index_->Delete(id)) << "[Delete: RC]";
+      if (id % 2 == 0) continue;
+      ASSERT_FALSE(index_->Insert(id, 2)) << "[Insert: RC]";
+    }
+    const auto mid_snap = index_->GetSnapshot();
+    ASSERT_FALSE(index_->Insert(kExecNum)) << "[Insert: RC]";
+    const auto new_snap = index_->GetSnapshot();
+
+    auto old_state = [](const size_t id) -> std::optional<Payload> {
+      if (id >= kExecNum) return std::nullopt;
+      return 1;
+    };
+    auto mid_state = [](const size_t id) -> std::optional<Payload> {
+      if (id >= kExecNum || id % 2 == 0) return std::nullopt;
+      return 2;
+    };
+    auto new_state = [&](const size_t id) -> std::optional<Payload> {
+      if (id == kExecNum) return 1;
+      return mid_state(id);
+    };
+    for (size_t id = 0; id <= kExecNum; ++id) {
+      ASSERT_EQ(index_->ReadAt(id, old_snap), old_state(id)) << "[ReadAt: old snapshot]";
+      ASSERT_EQ(index_->ReadAt(id, mid_snap), mid_state(id)) << "[ReadAt: middle snapshot]";
+      ASSERT_EQ(index_->ReadAt(id, new_snap), new_state(id)) << "[ReadAt: new snapshot]";
+      if constexpr (HasRead<Index, Key, Payload>()) {
+        ASSERT_EQ(index_->Read(id), new_state(id)) << "[Read: latest version]";
+      }
+    }
+    VerifyScanAt(old_snap, kExecNum + 1, old_state);
+    VerifyScanAt(mid_snap, kExecNum + 1, mid_state);
+    VerifyScanAt(new_snap, kExecNum + 1, new_state);
+
+    index_->ReleaseSnapshot(old_snap);
+    index_->ReleaseSnapshot(mid_snap);
+    index_->ReleaseSnapshot(new_snap);
+    if constexpr (HasConsolidate<Index>() && HasVersionCount<Index>()) {
+      // only the latest versions of live keys remain without pinned snapshots
+      index_->Consolidate();
+      ASSERT_EQ(*index_->GetVersionCount(), kExecNum / 2 + 1) << "[GetVersionCount]";
+    }
+  }
+
+  /**
+   * @brief Verify that concurrent snapshots read consistent states.
+   *
+   * Each writer deletes and re-inserts its keys alternately in ascending order.
+   * A snapshot must see a prefix of each writer's keys in a new state and the
+   * rest in the previous one, and its point reads must repeat its scan.
+   */
+  void
+  VerifySnapshotConsistency()
+  {
+    if (!HasSnapshotRead<Index, Key>()         //
+        || !HasSnapshotScan<Index, Key>()      //
+        || !HasWrite<Index, Key, Payload>()    //
+        || !HasInsert<Index, Key, Payload>()   //
+        || !HasDelete<Index, Key, Payload>())  //
+    {
+      GTEST_SKIP();
+    }
+
+    Preprocess(kToggleKeyNum);
+    std::atomic_size_t done_num{0};
+    std::atomic_size_t snap_num{0};
+    auto writer = [&](const size_t w_id) {
+      for (size_t r = 1; r <= kToggleRoundNum && !HasFailure(); ++r) {
+        for (size_t id = w_id; id < kToggleKeyNum; id += kWriterNum) {
+          if (r % 2 == 1) {
+            ASSERT_TRUE(index_->Delete(id)) << "[Delete: RC]";
+          } else {
+            ASSERT_FALSE(index_->Insert(id)) << "[Insert: RC]";
+          }
+        }
+      }
+      done_num.fetch_add(1);
+    };
+    auto reader = [&]([[maybe_unused]] const size_t r_id) {
+      std::vector<bool> visible(kToggleKeyNum);
+      for (size_t cnt = 0; (cnt == 0 || done_num.load() < kWriterNum) && !HasFailure(); ++cnt) {
+        const auto snapshot = index_->GetSnapshot();
+        std::fill(visible.begin(), visible.end(), false);
+        size_t id = 0;
+        for (auto&& iter = index_->ScanAt(snapshot); iter; ++iter, ++id) {
+          const auto& [key, payload] = *iter;
+          while (id < kToggleKeyNum && !Equal<Comp>(key, keys[id])) {
+            ++id;
+          }
+          ASSERT_LT(id, kToggleKeyNum) << "[ScanAt: key order]";
+          visible[id] = true;
+        }
+
+        for (size_t w_id = 0; w_id < kWriterNum; ++w_id) {
+          size_t change_num = 0;
+          for (size_t id = w_id + kWriterNum; id < kToggleKeyNum; id += kWriterNum) {
+            change_num += (visible[id] != visible[id - kWriterNum]) ? 1 : 0;
+          }
+          ASSERT_LE(change_num, 1) << "[ScanAt: snapshot consistency]";
+        }
+        for (size_t i = 0; i < kSampledReadNum; ++i) {
+          const auto id = i * kToggleKeyNum / kSampledReadNum;
+          const auto& ret = index_->ReadAt(id, snapshot);
+          ASSERT_EQ(ret.has_value(), visible[id]) << "[ReadAt: repeatable read]";
+        }
+        index_->ReleaseSnapshot(snapshot);
+        snap_num.fetch_add(1);
+      }
+    };
+    RunMT(writer, reader);
+    if (HasFailure()) return;
+
+    std::cout << "  [dbgroup] verified " << snap_num.load() << " snapshots during "
+              << kToggleRoundNum << " rounds of deletes/inserts\n";
+  }
+
+  /*##########################################################################*
+   * Functions for performance measurements
+   *##########################################################################*/
+
+  /**
+   * @brief Measure the cost of long-running readers pinning old snapshots.
+   *
+   * Writers keep overwriting random keys while each reader pins a snapshot for
+   * the given duration and reads random keys in it. The version count, memory
+   * usage, and reader latency are reported for each tenth of the duration, and
+   * the cost of reclaiming old versions is reported after readers release
+   * their snapshots. Note that the memory usage is accurate only if an index
+   * supports `GetMemoryUsage()`, since heap statistics also include the latency
+   * samples of readers.
+   *
+   * @param hold The duration for pinning snapshots.
+   */
+  void
+  MeasureSnapshotHoldWith(  //
+      const std::chrono::milliseconds hold)
+  {
+    if (!HasSnapshotRead<Index, Key>()        //
+        || !HasWrite<Index, Key, Payload>())  //
+    {
+      GTEST_SKIP();
+    }
+
+    const auto heap_base = GetHeapUsage();
+    Preprocess(kExecNum);
+    const auto load_mem = GetIndexMemoryUsage<Index>(*index_, heap_base);
+
+    std::atomic_bool is_running{true};
+    std::atomic_size_t pinned_num{0};
+    std::vector<OpCounter> write_cnt(kWriterNum);
+    LatencyRecorder latency{kReaderNum};
+    auto writer = [&](const size_t w_id) {
+      std::mt19937_64 rand_engine{kRandomSeed + w_id};
+      std::uniform_int_distribution<size_t> id_dist{0, kExecNum - 1};
+      while (is_running.load(std::memory_order_relaxed)) {
+        index_->Write(id_dist(rand_engine));
+        write_cnt[w_id].Increment();
+      }
+    };
+    auto reader = [&](const size_t r_id) {
+      std::mt19937_64 rand_engine{kRandomSeed + kWriterNum + r_id};
+      std::uniform_int_distribution<size_t> id_dist{0, kExecNum - 1};
+      latency.Reserve(r_id, kExecNum);
+      const auto snapshot = index_->GetSnapshot();
+      pinned_num.fetch_add(1);
+      while (is_running.load(std::memory_order_relaxed) && !HasFailure()) {
+        const auto id = id_dist(rand_engine);
+        const auto begin = GetTimestamp();
+        const auto& ret = index_->ReadAt(id, snapshot);
+        latency.Record(r_id, begin, GetTimestamp());
+        ASSERT_TRUE(ret) << "[ReadAt: pinned snapshot]";
+      }
+      index_->ReleaseSnapshot(snapshot);
+    };
+
+    uint64_t hold_begin{};
+    std::vector<uint64_t> step_ends(kHoldStepNum);
+    std::vector<std::optional<size_t>> step_versions(kHoldStepNum);
+    std::vector<size_t> step_mems(kHoldStepNum);
+    std::thread sampler{[&] {
+      while (pinned_num.load() < kReaderNum) {
+        std::this_thread::yield();
+      }
+      hold_begin = GetTimestamp();
+      auto wake = Clock_t::now();
+      for (size_t step = 0; step < kHoldStepNum; ++step) {
+        wake += hold / kHoldStepNum;
+        std::this_thread::sleep_until(wake);
+        step_ends[step] = GetTimestamp();
+        step_versions[step] = index_->GetVersionCount();
+        step_mems[step] = GetIndexMemoryUsage<Index>(*index_, heap_base);
+      }
+      is_running.store(false);
+    }};
+    const auto begin = GetTimestamp();
+    RunMT(writer, reader);
+    sampler.join();
+    const auto sec = static_cast<double>(GetTimestamp() - begin) / 1e9;
+    if (HasFailure()) return;
+
+    size_t write_num = 0;
+    for (const auto& cnt : write_cnt) {
+      write_num += cnt.Load();
+    }
+    std::cout << "  [dbgroup] hold " << hold.count() << " ms: " << kWriterNum << " writers ("
+              << static_cast<size_t>(write_num / sec) << " ops/s) and " << kReaderNum
+              << " readers (memory after loading " << load_mem / 1024 << " KiB)\n";
+    std::cout << "  [dbgroup] " << std::setw(10) << "time [ms]" << std::setw(12) << "versions"
+              << std::setw(15) << "memory [KiB]" << std::setw(12) << "p50 [ns]" << std::setw(12)
+              << "p99 [ns]" << '\n';
+    const auto& samples = latency.GetSamples();
+    auto step_begin = hold_begin;
+    for (size_t step = 0; step < kHoldStepNum; ++step) {
+      std::vector<uint64_t> lats{};
+      for (const auto& [b, e] : samples) {
+        if (b < step_begin || b >= step_ends[step]) continue;
+        lats.emplace_back(e - b);
+      }
+      const auto elapsed = hold.count() * static_cast<int64_t>(step + 1) / kHoldStepNum;
+      std::cout << "  [dbgroup] " << std::setw(10) << elapsed << std::setw(12);
+      if (step_versions[step]) {
+        std::cout << *step_versions[step];
+      } else {
+        std::cout << "-";
+      }
+      std::cout << std::setw(15) << step_mems[step] / 1024 << std::setw(12)
+                << GetQuantile(lats, 0.5) << std::setw(12) << GetQuantile(lats, 0.99) << '\n';
+      step_begin = step_ends[step];
+    }
+
+    const auto gc_begin = GetTimestamp();
+    index_->Consolidate();
+    const auto gc_ms = static_cast<double>(GetTimestamp() - gc_begin) / 1e6;
+    std::cout << "  [dbgroup] after releasing snapshots: ";
+    if (const auto& ver_num = index_->GetVersionCount(); ver_num) {
+      std::cout << *ver_num << " versions, ";
+    }
+    std::cout << GetIndexMemoryUsage<Index>(*index_, heap_base) / 1024 << " KiB";
+    if constexpr (HasConsolidate<Index>()) {
+      std::cout << " (consolidation " << gc_ms << " ms)";
+    }
+    std::cout << '\n';
+  }
+
+  /*##########################################################################*
+   * Static member variables
+   *##########################################################################*/
+
+  /// @brief Actual keys.
+  static inline std::vector<Key> keys;
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief An index for testing.
+  std::unique_ptr<IndexWrapper_t> index_{};
+};
+
+}  // namespace dbgroup::index::test
+
+#endif  // DBGROUP_INDEX_FIXTURES_INDEX_FIXTURE_SNAPSHOT_HPP
@@ -0,0 +1,32 @@
+/*----------------------------------------------------------------------------*
+ * Snapshot reads
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(SnapshotIndexFixture, ReadOldSnapshotsAfterDeletesAndInserts)
+{
+  TestFixture::VerifySnapshotVisibility();
+}
+
+TYPED_TEST(SnapshotIndexFixture, ReadConsistentSnapshotsDuringWrites)
+{
+  TestFixture::VerifySnapshotConsistency();
+}
+
+/*----------------------------------------------------------------------------*
+ * Performance measurements
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(SnapshotIndexFixture, HoldSnapshotsFor10msDuringWrites)
+{
+  TestFixture::MeasureSnapshotHoldWith(std::chrono::milliseconds{10});
+}
+
+TYPED_TEST(SnapshotIndexFixture, HoldSnapshotsFor100msDuringWrites)
+{
+  TestFixture::MeasureSnapshotHoldWith(std::chrono::milliseconds{100});
+}
+
+TYPED_TEST(SnapshotIndexFixture, HoldSnapshotsFor1sDuringWrites)
+{
+  TestFixture::MeasureSnapshotHoldWith(std::chrono::milliseconds{1000});
+}
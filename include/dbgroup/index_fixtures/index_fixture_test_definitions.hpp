@@ -11,13 +11,13 @@ TYPED_TEST(IndexFixture, ConstructWithoutSMOs)
 TYPED_TEST(IndexFixture, ConstructWithLeafSMOs)
 {
   constexpr auto kRecNum = TestFixture::kRecNumWithLeafSMOs;
-  TestFixture::VerifyWriteWith(!kWriteTwice, !kWithDelete, kSequential, kRecNum);
+  TestFixture::VerifyConstructWithSMOs(kRecNum);
 }
 
 TYPED_TEST(IndexFixture, ConstructWithInternalSMOs)
 {
   constexpr auto kRecNum = TestFixture::kRecNumWithInternalSMOs;
-  TestFixture::VerifyWriteWith(!kWriteTwice, !kWithDelete, kSequential, kRecNum);
+  TestFixture::VerifyConstructWithSMOs(kRecNum);
 }
 
 /*----------------------------------------------------------------------------*
@@ -53,6 +53,21 @@ TYPED_TEST(IndexFixture, ScanBackwardWithOpenedRangeExcludeLeftRightEnd)
   TestFixture::VerifyScanBackwardWith(kOpen);
 }
 
+TYPED_TEST(IndexFixture, ScanPrefixWithLoadedKeysReturnAllPrefixedKeys)
+{
+  TestFixture::VerifyScanPrefixWith(!kWithGaps);
+}
+
+TYPED_TEST(IndexFixture, ScanPrefixWithGapKeysReturnOnlyLoadedKeys)
+{
+  TestFixture::VerifyScanPrefixWith(kWithGaps);
+}
+
+TYPED_TEST(IndexFixture, MeasureScanPrefixBySelectivity)
+{
+  TestFixture::MeasureScanPrefix();
+}
+
 /*----------------------------------------------------------------------------*
  * Write operation
  *----------------------------------------------------------------------------*/
@@ -249,6 +264,55 @@ TYPED_TEST(IndexFixture, RandomUpdateWithDeletedKeysFail)
   TestFixture::VerifyUpdateWith(kWithWrite, kWithDelete, kRandom);
 }
 
+/*----------------------------------------------------------------------------*
+ * Compare-and-swap operation
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(IndexFixture, SequentialCompareAndSwapWithDuplicateKeysSucceed)
+{
+  TestFixture::VerifyCompareAndSwapWith(kWithWrite, !kWithDelete, kSequential);
+}
+
+TYPED_TEST(IndexFixture, SequentialCompareAndSwapWithNotInsertedKeysFail)
+{
+  TestFixture::VerifyCompareAndSwapWith(!kWithWrite, !kWithDelete, kSequential);
+}
+
+TYPED_TEST(IndexFixture, SequentialCompareAndSwapWithDeletedKeysFail)
+{
+  TestFixture::VerifyCompareAndSwapWith(kWithWrite, kWithDelete, kSequential);
+}
+
+TYPED_TEST(IndexFixture, ReverseCompareAndSwapWithDuplicateKeysSucceed)
+{
+  TestFixture::VerifyCompareAndSwapWith(kWithWrite, !kWithDelete, kReverse);
+}
+
+TYPED_TEST(IndexFixture, ReverseCompareAndSwapWithNotInsertedKeysFail)
+{
+  TestFixture::VerifyCompareAndSwapWith(!kWithWrite, !kWithDelete, kReverse);
+}
+
+TYPED_TEST(IndexFixture, ReverseCompareAndSwapWithDeletedKeysFail)
+{
+  TestFixture::VerifyCompareAndSwapWith(kWithWrite, kWithDelete, kReverse);
+}
+
+TYPED_TEST(IndexFixture, RandomCompareAndSwapWithDuplicateKeysSucceed)
+{
+  TestFixture::VerifyCompareAndSwapWith(kWithWrite, !kWithDelete, kRandom);
+}
+
+TYPED_TEST(IndexFixture, RandomCompareAndSwapWithNotInsertedKeysFail)
+{
+  TestFixture::VerifyCompareAndSwapWith(!kWithWrite, !kWithDelete, kRandom);
+}
+
+TYPED_TEST(IndexFixture, RandomCompareAndSwapWithDeletedKeysFail)
+{
+  TestFixture::VerifyCompareAndSwapWith(kWithWrite, kWithDelete, kRandom);
+}
+
 /*----------------------------------------------------------------------------*
  * Delete operation
  *----------------------------------------------------------------------------*/
@@ -298,6 +362,110 @@ TYPED_TEST(IndexFixture, RandomDeleteWithDeletedKeysFail)
   TestFixture::VerifyDeleteWith(kWithWrite, kWithDelete, kRandom);
 }
 
+/*----------------------------------------------------------------------------*
+ * Range delete operation
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(IndexFixture, DeleteRangeWithClosedBoundsSucceed)
+{
+  TestFixture::VerifyDeleteRangeWith(kExecNum / 4, kExecNum * 3 / 4, kClosed);
+}
+
+TYPED_TEST(IndexFixture, DeleteRangeWithOpenedBoundsSucceed)
+{
+  TestFixture::VerifyDeleteRangeWith(kExecNum / 4, kExecNum * 3 / 4, kOpen);
+}
+
+TYPED_TEST(IndexFixture, DeleteRangeWithoutBeginKeySucceed)
+{
+  TestFixture::VerifyDeleteRangeWith(std::nullopt, kExecNum / 2, kClosed);
+}
+
+TYPED_TEST(IndexFixture, DeleteRangeWithoutEndKeySucceed)
+{
+  TestFixture::VerifyDeleteRangeWith(kExecNum / 2, std::nullopt, kOpen);
+}
+
+TYPED_TEST(IndexFixture, DeleteRangeWithEmptyRangeFail)
+{
+  TestFixture::VerifyDeleteRangeWith(kExecNum / 2, kExecNum / 2, kOpen);
+}
+
+TYPED_TEST(IndexFixture, MeasureRangeDeleteAgainstPerKeyDeletes)
+{
+  TestFixture::MeasureRangeDelete();
+}
+
+/*----------------------------------------------------------------------------*
+ * Shrink workloads
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(IndexFixture, ShrinkWithRandomDeletes)
+{
+  constexpr auto kDeletePercent = TestFixture::kShrinkPercent;
+  TestFixture::MeasureShrinkWith(kRandom, kDeletePercent);
+}
+
+TYPED_TEST(IndexFixture, ShrinkWithClusteredDeletes)
+{
+  constexpr auto kDeletePercent = TestFixture::kShrinkPercent;
+  TestFixture::MeasureShrinkWith(kClustered, kDeletePercent);
+}
+
+TYPED_TEST(IndexFixture, ShrinkWithSequentialDeletes)
+{
+  constexpr auto kDeletePercent = TestFixture::kShrinkPercent;
+  TestFixture::MeasureShrinkWith(kSequential, kDeletePercent);
+}
+
+/*----------------------------------------------------------------------------*
+ * Negative lookups and gap-key workloads
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(IndexFixture, ReadWithOddGapMisses)
+{
+  TestFixture::VerifyReadWithMissesWith(kOddGaps, kMissPercent);
+}
+
+TYPED_TEST(IndexFixture, ReadWithHashedGapMisses)
+{
+  TestFixture::VerifyReadWithMissesWith(kHashedGaps, kMissPercent);
+}
+
+TYPED_TEST(IndexFixture, ReadOnlyGapKeysFail)
+{
+  TestFixture::VerifyReadWithMissesWith(kOddGaps, 100);
+}
+
+TYPED_TEST(IndexFixture, SequentialInsertIntoOddGaps)
+{
+  TestFixture::VerifyGapInsertWith(kOddGaps, kSequential);
+}
+
+TYPED_TEST(IndexFixture, ReverseInsertIntoOddGaps)
+{
+  TestFixture::VerifyGapInsertWith(kOddGaps, kReverse);
+}
+
+TYPED_TEST(IndexFixture, RandomInsertIntoOddGaps)
+{
+  TestFixture::VerifyGapInsertWith(kOddGaps, kRandom);
+}
+
+TYPED_TEST(IndexFixture, RandomInsertIntoHashedGaps)
+{
+  TestFixture::VerifyGapInsertWith(kHashedGaps, kRandom);
+}
+
+/*----------------------------------------------------------------------------*
+ * Record-merging workloads
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(IndexFixture, MeasureReadLatencyWithMergeDepths)
+{
+  TestFixture::MeasureMergeDepth();
+}
+
 /*----------------------------------------------------------------------------*
  * Bulkload operation
  *----------------------------------------------------------------------------*/
@@ -366,3 +534,18 @@ TYPED_TEST(IndexFixture, BulkloadWithRandomDelete)
 {
   TestFixture::VerifyBulkloadWith(kDelete, kRandom);
 }
+
+TYPED_TEST(IndexFixture, MeasureBulkloadThroughputWithStreamedInput)
+{
+  TestFixture::MeasureBulkloadThroughput();
+}
+
+TYPED_TEST(IndexFixture, MeasureBulkloadScalingWithSortedInput)
+{
+  TestFixture::MeasureBulkloadScalingWith(kPresorted);
+}
+
+TYPED_TEST(IndexFixture, MeasureBulkloadScalingWithUnsortedInput)
+{
+  TestFixture::MeasureBulkloadScalingWith(!kPresorted);
+}
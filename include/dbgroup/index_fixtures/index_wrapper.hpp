@@ -18,10 +18,15 @@
 #define DBGROUP_INDEX_FIXTURES_INDEX_WRAPPER_HPP
 
 // C++ standard libraries
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <stdexcept>
+#include <thread>
 #include <tuple>
 #include <vector>
 
@@ -34,6 +39,7 @@
 
 // local sources
 #include "common.hpp"
+#include "concepts.hpp"
 
 namespace dbgroup::index::test
 {
@@ -103,6 +109,161 @@ class IndexWrapper
     }
   }
 
+  /**
+   * @brief Run a worker function with multiple threads.
+   *
+   * Each thread sets up this index before the function and tears it down after
+   * that. The threads start the function together after all of them have set up
+   * the index, and `Barrier()` is called after all the threads finish.
+   *
+   * @param thread_num The number of worker threads.
+   * @param func A worker function that receives a worker ID.
+   */
+  void
+  RunWorkers(  //
+      const size_t thread_num,
+      const std::function<void(size_t)>& func)
+  {
+    std::atomic_size_t ready_num{0};
+    std::vector<std::thread> threads{};
+    threads.reserve(thread_num);
+    for (size_t i = 0; i < thread_num; ++i) {
+      threads.emplace_back([&, i] {
+        SetUp();
+        ++ready_num;
+        while (ready_num < thread_num) {
+          std::this_thread::yield();
+        }
+        func(i);
+        TearDown();
+      });
+    }
+    for (auto&& t : threads) {
+      t.join();
+    }
+    Barrier();
+  }
+
+  void
+  SetSMOHandler(  //
+      [[maybe_unused]] const SMOHandler& handler)
+  {
+    if constexpr (HasSMOHandler<Index>()) {
+      index_->SetSMOHandler(handler);
+    }
+  }
+
+  auto
+  GetMemoryUsage()  //
+      -> size_t
+  {
+    if constexpr (HasMemoryUsage<Index>()) {
+      return index_->GetMemoryUsage();
+    } else {
+      return 0;
+    }
+  }
+
+  void
+  Consolidate()
+  {
+    if constexpr (HasConsolidate<Index>()) {
+      index_->Consolidate();
+    }
+  }
+
+  auto
+  GetRetryCount()  //
+      -> std::optional<size_t>
+  {
+    if constexpr (HasRetryCount<Index>()) {
+      return index_->GetRetryCount();
+    } else {
+      return std::nullopt;
+    }
+  }
+
+  auto
+  GetNodeCount()  //
+      -> std::optional<size_t>
+  {
+    if constexpr (HasNodeCount<Index>()) {
+      return index_->GetNodeCount();
+    } else {
+      return std::nullopt;
+    }
+  }
+
+  auto
+  GetFillFactor()  //
+      -> std::optional<double>
+  {
+    if constexpr (HasFillFactor<Index>()) {
+      return index_->GetFillFactor();
+    } else {
+      return std::nullopt;
+    }
+  }
+
+  auto
+  GetLoadFactor()  //
+      -> std::optional<double>
+  {
+    if constexpr (HasLoadFactor<Index>()) {
+      return index_->GetLoadFactor();
+    } else {
+      return std::nullopt;
+    }
+  }
+
+  void
+  Reserve(  //
+      [[maybe_unused]] const size_t rec_num)
+  {
+    if constexpr (HasReserve<Index>()) {
+      index_->Reserve(rec_num);
+    }
+  }
+
+  auto
+  GetVersionCount()  //
+      -> std::optional<size_t>
+  {
+    if constexpr (HasVersionCount<Index>()) {
+      return index_->GetVersionCount();
+    } else {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * @return A token of a pinned snapshot.
+   */
+  auto
+  GetSnapshot()  //
+      -> uint64_t
+  {
+    if constexpr (HasSnapshotRead<Index, Key>()) {
+      return index_->GetSnapshot();
+    } else {
+      throw std::runtime_error{"The snapshot operation it not implemented."};
+    }
+  }
+
+  /**
+   * @param snapshot A token of a pinned snapshot.
+   */
+  void
+  ReleaseSnapshot(  //
+      [[maybe_unused]] const uint64_t snapshot)
+  {
+    if constexpr (HasSnapshotRead<Index, Key>()) {
+      index_->ReleaseSnapshot(snapshot);
+    } else {
+      throw std::runtime_error{"The snapshot operation it not implemented."};
+    }
+  }
+
   /*##########################################################################*
    * Wrapper functions
    *##########################################################################*/
@@ -184,6 +345,113 @@ class IndexWrapper
     }
   }
 
+  /**
+   * @brief Scan all the records whose keys start with a given key.
+   *
+   * If the index does not support prefix scans, this function performs a
+   * forward scan in [prefix, successor of prefix). The returned iterator owns
+   * the buffer of the successor.
+   *
+   * @param prefix_id The ID of a prefix key.
+   * @return An iterator of the records with the prefix.
+   */
+  auto
+  ScanPrefix(  //
+      [[maybe_unused]] const size_t prefix_id)
+  {
+    if constexpr (HasScanPrefix<Index, Key>()) {
+      const auto& prefix = keys_.at(prefix_id);
+      const auto len = GetLength(prefix) - 1;  // exclude the terminal character
+
+      decltype(index_->ScanPrefix(prefix, len)) ret{};
+      EXPECT_NO_THROW({
+        ret = index_->ScanPrefix(prefix, len);  //
+      }) << "[ScanPrefix: runtime error]";
+      return ret;
+    } else if constexpr (IsVarLenData<Key>() && HasScan<Index, Key, Payload>()) {
+      const auto& prefix = keys_.at(prefix_id);
+      const ScanKey b_key = std::make_tuple(prefix, GetLength(prefix), kClosed);
+
+      // the successor of a prefix is given by incrementing its last byte
+      auto len = GetLength(prefix) - 1;
+      auto end = std::make_unique<VarData>();
+      std::memcpy(end->data, prefix, len);
+      while (len > 0 && static_cast<unsigned char>(end->data[len - 1]) == 0xFF) {
+        --len;  // a trailing 0xFF cannot be incremented, so drop it
+      }
+      ScanKey e_key{};
+      if (len > 0) {
+        ++end->data[len - 1];
+        end->data[len] = '\0';
+        Key e_data = end->data;
+        e_key = std::make_tuple(e_data, len + 1, kOpen);
+      }
+
+      decltype(index_->Scan()) ret{};
+      EXPECT_NO_THROW({
+        ret = index_->Scan(b_key, e_key);  //
+      }) << "[Scan: runtime error]";
+      return BoundedIter{std::move(end), std::move(ret)};
+    } else {
+      throw std::runtime_error{"The prefix scan operation it not implemented."};
+      return DummyIter<Key, Payload>{};
+    }
+  }
+
+  /**
+   * @param key_id The ID of a target key.
+   * @param snapshot A token of a pinned snapshot.
+   * @return The payload visible to the snapshot if it exists.
+   */
+  auto
+  ReadAt(  //
+      [[maybe_unused]] const size_t key_id,
+      [[maybe_unused]] const uint64_t snapshot)  //
+      -> std::optional<Payload>
+  {
+    if constexpr (HasSnapshotRead<Index, Key>()) {
+      std::optional<Payload> ret;
+      EXPECT_NO_THROW({
+        const auto& key = keys_.at(key_id);
+        ret = index_->ReadAt(key, snapshot, GetLength(key));
+      }) << "[ReadAt: runtime error]";
+      return ret;
+    } else {
+      throw std::runtime_error{"The snapshot read operation it not implemented."};
+    }
+  }
+
+  auto
+  ScanAt(  //
+      [[maybe_unused]] const uint64_t snapshot,
+      [[maybe_unused]] const std::optional<size_t>& b_id = std::nullopt,
+      [[maybe_unused]] const bool b_closed = true,
+      [[maybe_unused]] const std::optional<size_t>& e_id = std::nullopt,
+      [[maybe_unused]] const bool e_closed = true)
+  {
+    if constexpr (HasSnapshotScan<Index, Key>()) {
+      ScanKey b_key{};
+      if (b_id) {
+        const auto& key = keys_.at(*b_id);
+        b_key = std::make_tuple(key, GetLength(key), b_closed);
+      }
+      ScanKey e_key{};
+      if (e_id) {
+        const auto& key = keys_.at(*e_id);
+        e_key = std::make_tuple(key, GetLength(key), e_closed);
+      }
+
+      decltype(index_->ScanAt(snapshot, b_key, e_key)) ret{};
+      EXPECT_NO_THROW({
+        ret = index_->ScanAt(snapshot, b_key, e_key);  //
+      }) << "[ScanAt: runtime error]";
+      return ret;
+    } else {
+      throw std::runtime_error{"The snapshot scan operation it not implemented."};
+      return DummyIter<Key, Payload>{};
+    }
+  }
+
   void
   Write(  //
       [[maybe_unused]] const size_t key_id)
@@ -224,15 +492,16 @@ class IndexWrapper
   }
 
   auto
-  Insert(                                    //
-      [[maybe_unused]] const size_t key_id)  //
+  Insert(  //
+      [[maybe_unused]] const size_t key_id,
+      [[maybe_unused]] const Payload& payload = 1)  //
       -> std::optional<Payload>
   {
     if constexpr (HasInsert<Index, Key, Payload>()) {
       std::optional<Payload> ret;
       EXPECT_NO_THROW({
         const auto& key = keys_.at(key_id);
-        ret = index_->Insert(key, 1, GetLength(key));  //
+        ret = index_->Insert(key, payload, GetLength(key));  //
       }) << "[Insert: runtime error]";
       return ret;
     } else {
@@ -261,6 +530,31 @@ class IndexWrapper
     }
   }
 
+  /**
+   * @param key_id The ID of a target key.
+   * @param expected An expected payload of the key.
+   * @param desired A payload written only if the current one is expected.
+   * @return The payload before this operation if the key exists.
+   */
+  auto
+  CompareAndSwap(  //
+      [[maybe_unused]] const size_t key_id,
+      [[maybe_unused]] const Payload& expected,
+      [[maybe_unused]] const Payload& desired)  //
+      -> std::optional<Payload>
+  {
+    if constexpr (HasCompareAndSwap<Index, Key, Payload>()) {
+      std::optional<Payload> ret;
+      EXPECT_NO_THROW({
+        const auto& key = keys_.at(key_id);
+        ret = index_->CompareAndSwap(key, expected, desired, GetLength(key));
+      }) << "[CompareAndSwap: runtime error]";
+      return ret;
+    } else {
+      throw std::runtime_error{"The compare-and-swap operation it not implemented."};
+    }
+  }
+
   auto
   Delete(                                    //
       [[maybe_unused]] const size_t key_id)  //
@@ -278,13 +572,83 @@ class IndexWrapper
     }
   }
 
+  /**
+   * @param key_id The ID of a target key.
+   * @param payload A target payload of the key.
+   * @return The deleted payload if the pair exists.
+   */
+  auto
+  Delete(  //
+      [[maybe_unused]] const size_t key_id,
+      [[maybe_unused]] const Payload& payload)  //
+      -> std::optional<Payload>
+  {
+    if constexpr (HasPairDelete<Index, Key, Payload>()) {
+      std::optional<Payload> ret;
+      EXPECT_NO_THROW({
+        const auto& key = keys_.at(key_id);
+        ret = index_->Delete(key, payload, GetLength(key));  //
+      }) << "[Delete: runtime error]";
+      return ret;
+    } else {
+      throw std::runtime_error{"The pair delete operation it not implemented."};
+    }
+  }
+
+  /**
+   * @param b_id An optional ID of a begin key.
+   * @param b_closed A flag for including the begin key.
+   * @param e_id An optional ID of an end key.
+   * @param e_closed A flag for including the end key.
+   * @return The number of deleted records.
+   */
+  auto
+  DeleteRange(  //
+      [[maybe_unused]] const std::optional<size_t>& b_id = std::nullopt,
+      [[maybe_unused]] const bool b_closed = true,
+      [[maybe_unused]] const std::optional<size_t>& e_id = std::nullopt,
+      [[maybe_unused]] const bool e_closed = true)  //
+      -> size_t
+  {
+    if constexpr (HasDeleteRange<Index, Key>()) {
+      ScanKey b_key{};
+      if (b_id) {
+        const auto& key = keys_.at(*b_id);
+        b_key = std::make_tuple(key, GetLength(key), b_closed);
+      }
+      ScanKey e_key{};
+      if (e_id) {
+        const auto& key = keys_.at(*e_id);
+        e_key = std::make_tuple(key, GetLength(key), e_closed);
+      }
+
+      size_t ret{};
+      EXPECT_NO_THROW({
+        ret = index_->DeleteRange(b_key, e_key);  //
+      }) << "[DeleteRange: runtime error]";
+      return ret;
+    } else {
+      throw std::runtime_error{"The range delete operation it not implemented."};
+    }
+  }
+
+  /**
+   * @param gaps An optional pattern of gap keys excluded from bulkloading.
+   */
   void
-  Bulkload()
+  Bulkload(  //
+      [[maybe_unused]] const std::optional<GapPattern>& gaps = std::nullopt)
   {
     if constexpr (HasBulkload<Index, Key, Payload>()) {
+      if (!gaps) {
+        Bulkload(BulkloadInput<Key, Payload>{keys_, kExecNum});
+        return;
+      }
+
       std::vector<std::tuple<Key, Payload, size_t>> entries{};
       entries.reserve(kExecNum);
       for (size_t i = 0; i < kExecNum; ++i) {
+        if (IsGapKey(i, *gaps)) continue;
         const auto& key = keys_.at(i);
         entries.emplace_back(key, 1, GetLength(key));
       }
@@ -297,6 +661,47 @@ class IndexWrapper
     }
   }
 
+  /**
+   * @brief Bulkload a lazily produced input.
+   *
+   * If the index does not accept `BulkloadInput`, the input is materialized.
+   *
+   * @param input Sorted entries.
+   * @param thread_num The number of threads for bulkloading.
+   */
+  void
+  Bulkload(  //
+      [[maybe_unused]] const BulkloadInput<Key, Payload>& input,
+      [[maybe_unused]] const size_t thread_num = kThreadNum)
+  {
+    if constexpr (HasBulkloadInput<Index, Key, Payload>()) {
+      EXPECT_NO_THROW({
+        index_->Bulkload(input, thread_num);  //
+      }) << "[Bulkload: runtime error]";
+    } else {
+      Bulkload(std::vector<std::tuple<Key, Payload, size_t>>{input.begin(), input.end()},
+               thread_num);
+    }
+  }
+
+  /**
+   * @param entries Sorted entries.
+   * @param thread_num The number of threads for bulkloading.
+   */
+  void
+  Bulkload(  //
+      [[maybe_unused]] const std::vector<std::tuple<Key, Payload, size_t>>& entries,
+      [[maybe_unused]] const size_t thread_num)
+  {
+    if constexpr (HasBulkload<Index, Key, Payload>()) {
+      EXPECT_NO_THROW({
+        index_->Bulkload(entries, thread_num);  //
+      }) << "[Bulkload: runtime error]";
+    } else {
+      throw std::runtime_error{"The bulkload operation it not implemented."};
+    }
+  }
+
  private:
   /*##########################################################################*
    * Internal member variables
@@ -0,0 +1,593 @@
+/*
+ * Copyright 2026 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_INDEX_FIXTURES_METRICS_HPP
+#define DBGROUP_INDEX_FIXTURES_METRICS_HPP
+
+// C++ standard libraries
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// system libraries
+#include <unistd.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+// local sources
+#include "common.hpp"
+#include "concepts.hpp"
+
+namespace dbgroup::index::test
+{
+/*############################################################################*
+ * Global utility functions
+ *############################################################################*/
+
+/**
+ * @return The current time in nanoseconds based on a monotonic clock.
+ */
+inline auto
+GetTimestamp() noexcept  //
+    -> uint64_t
+{
+  const auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+/**
+ * @return The number of bytes currently allocated in the heap. If the heap
+ * statistics are not available, the resident set size is returned instead.
+ */
+inline auto
+GetHeapUsage()  //
+    -> size_t
+{
+#ifdef __GLIBC__
+  const auto& info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+#else
+  std::ifstream statm{"/proc/self/statm"};
+  size_t total{};
+  size_t resident{};
+  statm >> total >> resident;
+  return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+/**
+ * @tparam Index A target index class.
+ * @tparam Wrapper A class for wrapping the target index.
+ * @param index A wrapper of the target index.
+ * @param heap_base The heap usage before constructing the index.
+ * @return The memory usage reported by the index if available. Otherwise, the
+ * heap growth since `heap_base`.
+ */
+template <class Index, class Wrapper>
+inline auto
+GetIndexMemoryUsage(  //
+    Wrapper& index,
+    const size_t heap_base)  //
+    -> size_t
+{
+  if constexpr (HasMemoryUsage<Index>()) {
+    return index.GetMemoryUsage();
+  } else {
+    const auto heap = GetHeapUsage();
+    return (heap > heap_base) ? heap - heap_base : 0;
+  }
+}
+
+/**
+ * @param vals Target values (this function reorders them).
+ * @param q A quantile in [0, 1].
+ * @return The `q`-th quantile of the given values.
+ */
+inline auto
+GetQuantile(  //
+    std::vector<uint64_t>& vals,
+    const double q)  //
+    -> uint64_t
+{
+  if (vals.empty()) return 0;
+
+  const auto pos = static_cast<size_t>(q * static_cast<double>(vals.size() - 1));
+  std::nth_element(vals.begin(), vals.begin() + pos, vals.end());
+  return vals[pos];
+}
+
+/*############################################################################*
+ * Global utility classes
+ *############################################################################*/
+
+/**
+ * @brief A per-worker counter of operations padded for avoiding false sharing.
+ *
+ */
+struct alignas(kCacheLineSize) OpCounter {
+  void
+  Increment() noexcept
+  {
+    // only the owner thread modifies this counter
+    cnt.store(cnt.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] auto
+  Load() const noexcept  //
+      -> size_t
+  {
+    return cnt.load(std::memory_order_relaxed);
+  }
+
+  std::atomic_size_t cnt{};
+};
+
+/**
+ * @brief A class for sampling the latency of each operation per worker.
+ *
+ */
+class LatencyRecorder
+{
+ public:
+  /*##########################################################################*
+   * Public types
+   *##########################################################################*/
+
+  /// @brief The begin/end timestamps of an operation.
+  struct Sample {
+    uint64_t begin{};
+    uint64_t end{};
+  };
+
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  explicit LatencyRecorder(  //
+      const size_t thread_num = 1)
+      : workers_(thread_num)
+  {
+  }
+
+  /*##########################################################################*
+   * Public utilities
+   *##########################################################################*/
+
+  void
+  Reserve(  //
+      const size_t w_id,
+      const size_t n)
+  {
+    workers_[w_id].samples.reserve(n);
+  }
+
+  void
+  Record(  //
+      const size_t w_id,
+      const uint64_t begin,
+      const uint64_t end)
+  {
+    workers_[w_id].samples.emplace_back(begin, end);
+  }
+
+  void
+  Clear()
+  {
+    for (auto&& worker : workers_) {
+      worker.samples.clear();
+    }
+  }
+
+  [[nodiscard]] auto
+  GetSamples() const  //
+      -> std::vector<Sample>
+  {
+    std::vector<Sample> samples{};
+    for (const auto& worker : workers_) {
+      samples.insert(samples.end(), worker.samples.begin(), worker.samples.end());
+    }
+    return samples;
+  }
+
+  [[nodiscard]] auto
+  GetLatencies() const  //
+      -> std::vector<uint64_t>
+  {
+    std::vector<uint64_t> lats{};
+    for (const auto& worker : workers_) {
+      for (const auto& [begin, end] : worker.samples) {
+        lats.emplace_back(end - begin);
+      }
+    }
+    return lats;
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal classes
+   *##########################################################################*/
+
+  /// @brief Samples of each worker padded for avoiding false sharing.
+  struct alignas(kCacheLineSize) Worker {
+    std::vector<Sample> samples{};
+  };
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief Latency samples per worker.
+  std::vector<Worker> workers_{};
+};
+
+/**
+ * @brief A class for recording SMOs reported by an index.
+ *
+ */
+class SMORecorder
+{
+ public:
+  /*##########################################################################*
+   * Public utilities
+   *##########################################################################*/
+
+  void
+  Record(  //
+      const SMOType type)
+  {
+    const auto ts = GetTimestamp();
+    const std::lock_guard guard{mtx_};
+    events_.emplace_back(type, ts);
+  }
+
+  void
+  Clear()
+  {
+    const std::lock_guard guard{mtx_};
+    events_.clear();
+  }
+
+  [[nodiscard]] auto
+  GetCounts()  //
+      -> std::array<size_t, kSMOTypeNum>
+  {
+    std::array<size_t, kSMOTypeNum> counts{};
+    const std::lock_guard guard{mtx_};
+    for (const auto& [type, _] : events_) {
+      ++counts[type];
+    }
+    return counts;
+  }
+
+  /**
+   * @param samples Latency samples of operations.
+   * @param threshold A latency threshold for tail operations.
+   * @return The number of tail operations and the number of them that
+   * overlapped with any SMO.
+   */
+  [[nodiscard]] auto
+  CountOverlaps(  //
+      const std::vector<LatencyRecorder::Sample>& samples,
+      const uint64_t threshold)  //
+      -> std::pair<size_t, size_t>
+  {
+    std::vector<uint64_t> stamps{};
+    {
+      const std::lock_guard guard{mtx_};
+      stamps.reserve(events_.size());
+      for (const auto& [_, ts] : events_) {
+        stamps.emplace_back(ts);
+      }
+    }
+    std::sort(stamps.begin(), stamps.end());
+
+    size_t tail_num = 0;
+    size_t overlap_num = 0;
+    for (const auto& [begin, end] : samples) {
+      if (end - begin < threshold) continue;
+      ++tail_num;
+      const auto it = std::lower_bound(stamps.begin(), stamps.end(), begin);
+      if (it != stamps.end() && *it <= end) {
+        ++overlap_num;
+      }
+    }
+    return {tail_num, overlap_num};
+  }
+
+  /**
+   * @brief Print the number of SMOs and their correlation with tail latency.
+   *
+   * @param latency Latency samples of operations during SMOs are recorded.
+   */
+  void
+  Report(  //
+      const LatencyRecorder& latency)
+  {
+    constexpr std::array<double, 3> kQuantiles = {0.99, 0.999, 0.9999};
+
+    const auto& counts = GetCounts();
+    std::cout << "  [dbgroup] SMOs: leaf split " << counts[kLeafSplit]  //
+              << ", internal split " << counts[kInternalSplit]          //
+              << ", merge " << counts[kMerge]                           //
+              << ", root growth " << counts[kRootGrowth]                //
+              << ", resize " << counts[kResize] << "\n";
+
+    const auto& samples = latency.GetSamples();
+    auto&& lats = latency.GetLatencies();
+    for (const auto q : kQuantiles) {
+      const auto threshold = GetQuantile(lats, q);
+      const auto [tail_num, overlap_num] = CountOverlaps(samples, threshold);
+      const auto ratio = (tail_num == 0) ? 0.0 : 100.0 * overlap_num / tail_num;
+      std::cout << "  [dbgroup]   p" << q * 100 << ": " << threshold << " ns ("  //
+                << ratio << "% of " << tail_num << " ops overlap SMOs)\n";
+    }
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal classes
+   *##########################################################################*/
+
+  /// @brief An SMO event with its timestamp.
+  struct Event {
+    SMOType type{};
+    uint64_t ts{};
+  };
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief A mutex for protecting events.
+  std::mutex mtx_{};
+
+  /// @brief Recorded SMO events.
+  std::vector<Event> events_{};
+};
+
+/**
+ * @brief A class for sampling the throughput of workers at fixed intervals.
+ *
+ * Each worker increments its own counter, and a sampler thread reads all the
+ * counters periodically to expose throughput changes within a phase.
+ */
+class ThroughputTimeline
+{
+ public:
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  ThroughputTimeline(  //
+      const size_t worker_num,
+      const size_t interval_ms)
+      : counters_(worker_num)
+      , interval_{interval_ms}
+  {
+  }
+
+  ThroughputTimeline(const ThroughputTimeline&) = delete;
+  ThroughputTimeline(ThroughputTimeline&&) = delete;
+
+  auto operator=(const ThroughputTimeline&) -> ThroughputTimeline& = delete;
+  auto operator=(ThroughputTimeline&&) -> ThroughputTimeline& = delete;
+
+  ~ThroughputTimeline() { Stop(); }
+
+  /*##########################################################################*
+   * Public utilities
+   *##########################################################################*/
+
+  auto
+  GetCounter(  //
+      const size_t w_id)  //
+      -> OpCounter*
+  {
+    return &counters_[w_id];
+  }
+
+  /**
+   * @return The total number of operations counted by all the workers.
+   */
+  [[nodiscard]] auto
+  GetTotal() const  //
+      -> size_t
+  {
+    size_t total = 0;
+    for (const auto& counter : counters_) {
+      total += counter.Load();
+    }
+    return total;
+  }
+
+  /**
+   * @brief Sample memory consumption with throughput.
+   *
+   * @param sampler A function returning memory consumption in bytes.
+   */
+  void
+  SampleMemoryWith(  //
+      std::function<size_t()> sampler)
+  {
+    mem_sampler_ = std::move(sampler);
+  }
+
+  void
+  Start()
+  {
+    Sample();
+    is_running_ = true;
+    sampler_ = std::thread{[this] {
+      // throughput is computed with actual timestamps, so drifts are acceptable
+      std::unique_lock lock{mtx_};
+      while (!cv_.wait_for(lock, interval_, [this] { return !is_running_; })) {
+        Sample();
+      }
+    }};
+  }
+
+  /**
+   * @brief Wake up and stop the sampler thread.
+   *
+   * The last interval is sampled only if it is long enough to compute stable
+   * throughput.
+   */
+  void
+  Stop()
+  {
+    if (!sampler_.joinable()) return;
+
+    {
+      const std::lock_guard guard{mtx_};
+      is_running_ = false;
+    }
+    cv_.notify_all();
+    sampler_.join();
+
+    const auto min_ns = std::chrono::nanoseconds{interval_}.count() / kMinTailDivisor;
+    if (GetTimestamp() - samples_.back().ts >= static_cast<uint64_t>(min_ns)) {
+      Sample();
+    }
+  }
+
+  /**
+   * @brief Print total/slowest-worker throughput [ops/s] per interval.
+   *
+   */
+  void
+  Report() const
+  {
+    if (samples_.empty()) return;
+
+    std::cout << "  [dbgroup] timeline (elapsed [ms], throughput [ops/s], "
+                 "min worker throughput [ops/s]"
+              << (mem_sampler_ ? ", memory [B]" : "") << "):\n";
+    const auto w_num = counters_.size();
+    const auto start = samples_.front().ts;
+    for (size_t i = 1; i < samples_.size(); ++i) {
+      const auto& prev = samples_[i - 1];
+      const auto& cur = samples_[i];
+      const auto sec = static_cast<double>(cur.ts - prev.ts) / 1e9;
+      if (sec <= 0) continue;
+
+      size_t total = 0;
+      size_t min = ~0UL;
+      for (size_t j = 0; j < w_num; ++j) {
+        const auto diff = cur.cnts[j] - prev.cnts[j];
+        total += diff;
+        min = std::min(min, diff);
+      }
+      std::cout << "  [dbgroup]   " << (cur.ts - start) / 1000000 << ", "  //
+                << static_cast<size_t>(total / sec) << ", "                 //
+                << static_cast<size_t>(min / sec);
+      if (mem_sampler_) {
+        std::cout << ", " << cur.mem;
+      }
+      std::cout << "\n";
+    }
+
+    const auto& last = samples_.back();
+    const auto sec = static_cast<double>(last.ts - start) / 1e9;
+    size_t total = 0;
+    for (const auto cnt : last.cnts) {
+      total += cnt;
+    }
+    if (sec > 0) {
+      std::cout << "  [dbgroup]   average: " << static_cast<size_t>(total / sec) << " ops/s\n";
+    }
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The last interval shorter than `interval_ / kMinTailDivisor` is dropped.
+  static constexpr int64_t kMinTailDivisor = 4;
+
+  /*##########################################################################*
+   * Internal classes
+   *##########################################################################*/
+
+  /// @brief A snapshot of all the counters.
+  struct Snapshot {
+    uint64_t ts{};
+    std::vector<size_t> cnts{};
+    size_t mem{};
+  };
+
+  /*##########################################################################*
+   * Internal utilities
+   *##########################################################################*/
+
+  void
+  Sample()
+  {
+    auto& snapshot = samples_.emplace_back();
+    snapshot.ts = GetTimestamp();
+    snapshot.cnts.reserve(counters_.size());
+    for (const auto& counter : counters_) {
+      snapshot.cnts.emplace_back(counter.Load());
+    }
+    if (mem_sampler_) {
+      snapshot.mem = mem_sampler_();
+    }
+  }
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief Per-worker counters.
+  std::vector<OpCounter> counters_{};
+
+  /// @brief The sampling interval.
+  std::chrono::milliseconds interval_{};
+
+  /// @brief Sampled counters.
+  std::vector<Snapshot> samples_{};
+
+  /// @brief An optional function for sampling memory consumption.
+  std::function<size_t()> mem_sampler_{};
+
+  /// @brief A mutex for waking up the sampler thread.
+  std::mutex mtx_{};
+
+  /// @brief A condition variable for waking up the sampler thread.
+  std::condition_variable cv_{};
+
+  /// @brief A flag for stopping the sampler thread.
+  bool is_running_{};
+
+  /// @brief A sampler thread.
+  std::thread sampler_{};
+};
+
+}  // namespace dbgroup::index::test
+
+#endif  // DBGROUP_INDEX_FIXTURES_METRICS_HPP
@@ -0,0 +1,505 @@
+/*
+ * Copyright 2026 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_INDEX_FIXTURES_TRANSPORT_HPP
+#define DBGROUP_INDEX_FIXTURES_TRANSPORT_HPP
+
+// C++ standard libraries
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// system libraries
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// local sources
+#include "cluster.hpp"
+#include "common.hpp"
+#include "metrics.hpp"
+
+namespace dbgroup::index::test
+{
+/*############################################################################*
+ * Global utility classes
+ *############################################################################*/
+
+/**
+ * @brief Parameters of an emulated network.
+ *
+ */
+struct NetworkConfig {
+  /// @brief A round-trip time [ns] (each message is delayed by its half).
+  uint64_t rtt{kNetworkRTT};
+
+  /// @brief The maximum jitter [ns] added to each message.
+  uint64_t jitter{kNetworkJitter};
+
+  /// @brief The bandwidth of each link [MB/s] (zero means unlimited).
+  uint64_t bandwidth{kNetworkBandwidth};
+};
+
+/**
+ * @brief A loopback transport emulating the network between local nodes.
+ *
+ * Each node receives requests via a Unix domain socket in the abstract
+ * namespace, and a server thread queues them by their delivery time. Handler
+ * threads take due requests from the queue and handle them with a registered
+ * handler, so concurrent requests are delayed in parallel. Every message is
+ * delivered after the emulated delay, i.e., the half of RTT, random jitter, and
+ * queueing at the link's bandwidth. The delay is a lower bound because the
+ * actual cost of the local sockets is included in it.
+ *
+ * The transport counts round trips (i.e., `Call`s), and the fixtures report the
+ * number of round trips per operation if an index uses this transport.
+ */
+class LoopbackTransport
+{
+ public:
+  /*##########################################################################*
+   * Public types
+   *##########################################################################*/
+
+  /// @brief A request handler that receives a source node ID and a request.
+  using Handler = std::function<std::string(size_t, const std::string&)>;
+
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  explicit LoopbackTransport(  //
+      const NetworkConfig& config = NetworkConfig{},
+      const size_t node_id = NodeContext::GetNodeID(),
+      const size_t node_num = kNodeNum)
+      : config_{config}, node_id_{node_id}, links_(node_num)
+  {
+  }
+
+  LoopbackTransport(const LoopbackTransport&) = delete;
+  LoopbackTransport(LoopbackTransport&&) = delete;
+
+  auto operator=(const LoopbackTransport&) -> LoopbackTransport& = delete;
+  auto operator=(LoopbackTransport&&) -> LoopbackTransport& = delete;
+
+  ~LoopbackTransport()
+  {
+    {
+      const std::lock_guard guard{queue_mtx_};
+      is_running_ = false;
+    }
+    queue_cv_.notify_all();
+    if (server_.joinable()) {
+      server_.join();
+    }
+    for (auto&& t : handlers_) {
+      t.join();
+    }
+    if (server_fd_ >= 0) {
+      ::close(server_fd_);
+    }
+  }
+
+  /*##########################################################################*
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Start server threads for handling requests to this node.
+   *
+   * The handler is called concurrently by `kThreadNum` threads per node, i.e.,
+   * as many as the callers in a cluster, so it must be thread-safe. Callers
+   * should synchronize nodes (e.g., `NodeContext::Barrier`) after this function
+   * so that other nodes can send requests.
+   *
+   * @param handler A request handler.
+   */
+  void
+  Serve(  //
+      Handler handler)
+  {
+    server_fd_ = Bind(GetPath(node_id_));
+    handler_ = std::move(handler);
+    is_running_ = true;
+    server_ = std::thread{&LoopbackTransport::RunServer, this};
+    const auto handler_num = kThreadNum * links_.size();
+    handlers_.reserve(handler_num);
+    for (size_t i = 0; i < handler_num; ++i) {
+      handlers_.emplace_back(&LoopbackTransport::RunHandler, this);
+    }
+  }
+
+  /**
+   * @brief Send a request to a node and wait for its response.
+   *
+   * Each message must be smaller than 64 KiB including a 24-byte header. Each
+   * calling thread has its own socket in this transport, and a response is
+   * accepted only if its source and sequence number match the request.
+   *
+   * @param dst The ID of a destination node.
+   * @param req A request message.
+   * @return A response message.
+   */
+  auto
+  Call(  //
+      const size_t dst,
+      const std::string& req)  //
+      -> std::string
+  {
+    auto& client = GetClientSocket();
+    const auto seq = ++client.seq;
+
+    const auto dst_addr = GetAddress(GetPath(dst));
+    Send(client.fd, dst_addr, dst, seq, req);
+    while (true) {
+      auto [header, res] = Receive(client.fd);
+      if (header.src != dst || header.seq != seq) continue;  // a late response
+
+      WaitUntil(header.deliver_at);
+      round_trips_.fetch_add(1, std::memory_order_relaxed);
+      return std::move(res);
+    }
+  }
+
+  /**
+   * @return The total number of round trips in this process.
+   */
+  static auto
+  GetRoundTrips()  //
+      -> size_t
+  {
+    return round_trips_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal classes
+   *##########################################################################*/
+
+  /// @brief The header of each message.
+  struct Header {
+    /// @brief The time when a receiver can consume this message.
+    uint64_t deliver_at{};
+
+    /// @brief The ID of a source node.
+    uint64_t src{};
+
+    /// @brief The sequence number of a request (echoed by its response).
+    uint64_t seq{};
+  };
+
+  /// @brief A received request waiting for its delivery time.
+  struct Request {
+    /// @brief The header of this request.
+    Header header{};
+
+    /// @brief The address of a source socket for sending a response.
+    sockaddr_un from{};
+
+    /// @brief The body of this request.
+    std::string body{};
+
+    /// @brief An order for popping the earliest request from a max heap.
+    auto
+    operator<(  //
+        const Request& rhs) const  //
+        -> bool
+    {
+      return header.deliver_at > rhs.header.deliver_at;
+    }
+  };
+
+  /// @brief The state of an outgoing link padded for avoiding false sharing.
+  struct alignas(kCacheLineSize) Link {
+    std::mutex mtx{};
+    uint64_t free_at{};
+  };
+
+  /// @brief A per-thread socket for receiving responses.
+  struct ClientSocket {
+    explicit ClientSocket(  //
+        const LoopbackTransport* transport)
+        : fd{Bind(transport->GetClientPath(client_counter_++))}
+    {
+    }
+
+    ClientSocket(const ClientSocket&) = delete;
+    ClientSocket(ClientSocket&&) = delete;
+
+    auto operator=(const ClientSocket&) -> ClientSocket& = delete;
+    auto operator=(ClientSocket&&) -> ClientSocket& = delete;
+
+    ~ClientSocket() { ::close(fd); }
+
+    /// @brief A socket bound to a unique address.
+    int fd{};
+
+    /// @brief The sequence number of the last request.
+    uint64_t seq{};
+  };
+
+  /*##########################################################################*
+   * Internal utilities
+   *##########################################################################*/
+
+  /**
+   * @return The socket of the calling thread in this transport.
+   */
+  auto
+  GetClientSocket()  //
+      -> ClientSocket&
+  {
+    const std::lock_guard guard{clients_mtx_};
+    return clients_.try_emplace(std::this_thread::get_id(), this).first->second;
+  }
+
+  void
+  RunServer()
+  {
+    std::vector<char> buf(kMaxMessageSize);
+    while (is_running_) {
+      pollfd pfd{server_fd_, POLLIN, 0};
+      if (::poll(&pfd, 1, kPollTimeout) <= 0) continue;
+
+      sockaddr_un from{};
+      socklen_t from_len = sizeof(from);
+      const auto n = ::recvfrom(server_fd_, buf.data(), buf.size(), 0,
+                                reinterpret_cast<sockaddr*>(&from), &from_len);  // NOLINT
+      if (n < static_cast<ssize_t>(sizeof(Header))) continue;
+
+      Request req{{}, from, std::string{buf.data() + sizeof(Header), n - sizeof(Header)}};
+      std::memcpy(&req.header, buf.data(), sizeof(Header));
+      {
+        const std::lock_guard guard{queue_mtx_};
+        queue_.push(std::move(req));
+      }
+      queue_cv_.notify_one();
+    }
+  }
+
+  void
+  RunHandler()
+  {
+    while (true) {
+      Request req{};
+      {
+        std::unique_lock lock{queue_mtx_};
+        queue_cv_.wait(lock, [this] { return !queue_.empty() || !is_running_; });
+        if (queue_.empty()) return;  // stopped
+
+        // take the earliest one so that other handlers can wait for later ones
+        req = queue_.top();
+        queue_.pop();
+      }
+
+      WaitUntil(req.header.deliver_at);
+      const auto& [header, from, body] = req;
+      Send(server_fd_, from, header.src, header.seq, handler_(header.src, body));
+    }
+  }
+
+  void
+  Send(  //
+      const int fd,
+      const sockaddr_un& addr,
+      const size_t dst,
+      const uint64_t seq,
+      const std::string& msg)
+  {
+    if (sizeof(Header) + msg.size() > kMaxMessageSize) {
+      throw std::runtime_error{"The message exceeds the maximum size."};
+    }
+
+    Header header{GetDeliveryTime(dst, sizeof(Header) + msg.size()), node_id_, seq};
+    std::string buf(sizeof(Header) + msg.size(), '\0');
+    std::memcpy(buf.data(), &header, sizeof(Header));
+    std::memcpy(buf.data() + sizeof(Header), msg.data(), msg.size());
+    if (::sendto(fd, buf.data(), buf.size(), 0, reinterpret_cast<const sockaddr*>(&addr),  // NOLINT
+                 sizeof(addr)) != static_cast<ssize_t>(buf.size())) {
+      throw std::runtime_error{"Failed to send a message."};
+    }
+  }
+
+  /**
+   * @param fd A socket for receiving a message.
+   * @return The header and body of a received message (not delayed yet).
+   */
+  static auto
+  Receive(  //
+      const int fd)  //
+      -> std::pair<Header, std::string>
+  {
+    std::vector<char> buf(kMaxMessageSize);
+    const auto n = ::recv(fd, buf.data(), buf.size(), 0);
+    if (n < static_cast<ssize_t>(sizeof(Header))) {
+      throw std::runtime_error{"Failed to receive a message."};
+    }
+
+    Header header{};
+    std::memcpy(&header, buf.data(), sizeof(Header));
+    return {header, std::string{buf.data() + sizeof(Header), n - sizeof(Header)}};
+  }
+
+  auto
+  GetDeliveryTime(  //
+      const size_t dst,
+      const size_t size)  //
+      -> uint64_t
+  {
+    thread_local std::mt19937_64 rand_engine{std::random_device{}()};
+
+    auto now = GetTimestamp();
+    if (config_.bandwidth > 0) {
+      // messages to the same node are serialized on the link
+      auto& link = links_.at(dst);
+      const std::lock_guard guard{link.mtx};
+      const auto trans_time = size * 1000 / config_.bandwidth;  // MB/s = B/us
+      link.free_at = std::max(link.free_at, now) + trans_time;
+      now = link.free_at;
+    }
+    const auto jitter = (config_.jitter > 0) ? rand_engine() % (config_.jitter + 1) : 0;
+    return now + config_.rtt / 2 + jitter;
+  }
+
+  static void
+  WaitUntil(  //
+      const uint64_t deliver_at)
+  {
+    while (GetTimestamp() < deliver_at) {
+      std::this_thread::yield();
+    }
+  }
+
+  static auto
+  Bind(  //
+      const std::string& path)  //
+      -> int
+  {
+    const auto fd = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+    const auto addr = GetAddress(path);
+    if (fd < 0 || ::bind(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {  // NOLINT
+      throw std::runtime_error{"Failed to bind a transport socket."};
+    }
+    return fd;
+  }
+
+  static auto
+  GetPath(  //
+      const size_t node_id)  //
+      -> std::string
+  {
+    return "dbgroup_transport_" + NodeContext::GetClusterID() + "_" + std::to_string(node_id);
+  }
+
+  [[nodiscard]] auto
+  GetClientPath(  //
+      const size_t client_id) const  //
+      -> std::string
+  {
+    return "dbgroup_transport_" + NodeContext::GetClusterID() + "_" + std::to_string(node_id_)
+           + "_client_" + std::to_string(client_id);
+  }
+
+  static auto
+  GetAddress(  //
+      const std::string& path)  //
+      -> sockaddr_un
+  {
+    // use the abstract namespace to release addresses when processes exit
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path + 1, path.c_str(), sizeof(addr.sun_path) - 2);
+    return addr;
+  }
+
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The maximum size of each message.
+  static constexpr size_t kMaxMessageSize = 64 * 1024;
+
+  /// @brief The timeout [ms] for checking the termination of a server.
+  static constexpr int kPollTimeout = 10;
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief Parameters of an emulated network.
+  NetworkConfig config_{};
+
+  /// @brief The ID of this node.
+  size_t node_id_{};
+
+  /// @brief Outgoing links to each node.
+  std::vector<Link> links_{};
+
+  /// @brief A socket for receiving requests.
+  int server_fd_{-1};
+
+  /// @brief A request handler.
+  Handler handler_{};
+
+  /// @brief A flag for stopping a server thread.
+  std::atomic_bool is_running_{false};
+
+  /// @brief A server thread for receiving requests.
+  std::thread server_{};
+
+  /// @brief Threads for handling due requests.
+  std::vector<std::thread> handlers_{};
+
+  /// @brief A mutex for queueing requests.
+  std::mutex queue_mtx_{};
+
+  /// @brief A condition variable for notifying handlers of requests.
+  std::condition_variable queue_cv_{};
+
+  /// @brief Received requests ordered by their delivery time.
+  std::priority_queue<Request> queue_{};
+
+  /// @brief A mutex for registering client sockets.
+  std::mutex clients_mtx_{};
+
+  /// @brief Client sockets of each calling thread (closed with this transport).
+  std::unordered_map<std::thread::id, ClientSocket> clients_{};
+
+  /// @brief A counter for naming per-thread client sockets.
+  static inline std::atomic_size_t client_counter_{0};
+
+  /// @brief The total number of round trips in this process.
+  static inline std::atomic_size_t round_trips_{0};
+};
+
+}  // namespace dbgroup::index::test
+
+#endif  // DBGROUP_INDEX_FIXTURES_TRANSPORT_HPP
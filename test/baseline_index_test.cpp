@@ -0,0 +1,183 @@
+/*
+ * Copyright 2026 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include <dbgroup/index_fixtures/baseline_indexes.hpp>
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// external libraries
+#include <dbgroup/index_fixtures/index_fixture.hpp>
+
+namespace dbgroup::index::test
+{
+/*############################################################################*
+ * A mock index for testing SMO tracing
+ *############################################################################*/
+
+/// @brief The number of records per leaf node in the mock index.
+constexpr size_t kMockLeafCapacity = 8;
+
+/**
+ * @brief A mock index that only counts records and reports leaf splits/merges.
+ *
+ * @tparam Key A class of stored keys.
+ * @tparam Payload A class of stored payloads.
+ * @tparam Comp A comparator for keys.
+ */
+template <class Key, class Payload, class Comp>
+class SMOMockIndex
+{
+  using MergeFn = Payload (*)(const Payload&, const Payload&);
+
+ public:
+  void
+  SetSMOHandler(  //
+      SMOHandler handler)
+  {
+    smo_handler_ = std::move(handler);
+  }
+
+  void
+  Write(  //
+      [[maybe_unused]] const Key& key,
+      [[maybe_unused]] const Payload& payload,
+      [[maybe_unused]] const size_t key_len = sizeof(Key),
+      [[maybe_unused]] const MergeFn merge = nullptr)
+  {
+    if (++rec_num_ % kMockLeafCapacity == 0 && smo_handler_) {
+      smo_handler_(kLeafSplit);
+    }
+  }
+
+  auto
+  Delete(  //
+      [[maybe_unused]] const Key& key,
+      [[maybe_unused]] const size_t key_len = sizeof(Key))  //
+      -> std::optional<Payload>
+  {
+    if (rec_num_-- % kMockLeafCapacity == 0 && smo_handler_) {
+      smo_handler_(kMerge);
+    }
+    return Payload{};
+  }
+
+ private:
+  /// @brief A callback for notifying SMOs.
+  SMOHandler smo_handler_{};
+
+  /// @brief The number of stored records.
+  size_t rec_num_{0};
+};
+
+/*############################################################################*
+ * Preparation for typed testing
+ *############################################################################*/
+
+using TestTargets = ::testing::Types<             //
+    IndexInfo<ShardedMapIndex, UInt8, UInt8>,     // sharded std::map
+    IndexInfo<ShardedMapIndex, Var, UInt4>,       // sharded std::map/varlen keys
+    IndexInfo<SortedArrayIndex, Var, UInt8>,      // sorted array/varlen keys
+    IndexInfo<OpenAddressingIndex, UInt8, UInt4>  // hash table
+    >;
+TYPED_TEST_SUITE(IndexFixture, TestTargets);
+
+/*############################################################################*
+ * Unit test definitions
+ *############################################################################*/
+
+#include "dbgroup/index_fixtures/index_fixture_test_definitions.hpp"
+
+TEST(IndexWrapperTest, SetSMOHandlerForwardsReportedSMOs)
+{
+  constexpr size_t kRecNum = 1000;
+
+  using IndexInfo_t = IndexInfo<SMOMockIndex, UInt8, UInt8>;
+  static_assert(HasSMOHandler<typename IndexInfo_t::Index>());
+  static_assert(!HasSMOHandler<typename IndexInfo<ShardedMapIndex, UInt8, UInt8>::Index>());
+
+  std::vector<uint64_t> keys(kRecNum);
+  std::iota(keys.begin(), keys.end(), 0);
+  IndexWrapper<IndexInfo_t> index{keys};
+  SMORecorder recorder{};
+  index.SetSMOHandler([&](const SMOType type) { recorder.Record(type); });
+
+  for (size_t i = 0; i < kRecNum; ++i) {
+    index.Write(i);
+  }
+  const auto& split_counts = recorder.GetCounts();
+  EXPECT_EQ(split_counts[kLeafSplit], kRecNum / kMockLeafCapacity);
+  EXPECT_EQ(split_counts[kMerge], 0);
+
+  for (size_t i = 0; i < kRecNum; ++i) {
+    index.Delete(i);
+  }
+  const auto& merge_counts = recorder.GetCounts();
+  EXPECT_EQ(merge_counts[kMerge], kRecNum / kMockLeafCapacity);
+}
+
+TEST(BaselineIndexTest, BulkloadWithZeroThreadsUsesOneThread)
+{
+  constexpr size_t kRecNum = 1000;
+
+  std::vector<std::tuple<uint64_t, uint64_t, size_t>> entries{};
+  entries.reserve(kRecNum);
+  for (uint64_t i = 0; i < kRecNum; ++i) {
+    entries.emplace_back(i, i, sizeof(uint64_t));
+  }
+
+  typename IndexInfo<ShardedMapIndex, UInt8, UInt8>::Index sharded{};
+  sharded.Bulkload(entries, 0);
+  typename IndexInfo<SortedArrayIndex, UInt8, UInt8>::Index sorted{};
+  sorted.Bulkload(entries, 0);
+  for (uint64_t i = 0; i < kRecNum; ++i) {
+    EXPECT_EQ(sharded.Read(i), i) << "[ShardedMapIndex: payload]";
+    EXPECT_EQ(sorted.Read(i), i) << "[SortedArrayIndex: payload]";
+  }
+}
+
+TEST(VersionedMapIndexTest, MemoryUsageIncludesPinnedVersions)
+{
+  constexpr size_t kRecNum = 1000;
+  constexpr size_t kOverwriteNum = 10;
+
+  using Index_t = typename IndexInfo<VersionedMapIndex, UInt8, UInt8>::Index;
+  Index_t index{};
+  for (uint64_t i = 0; i < kRecNum; ++i) {
+    index.Write(i, i);
+  }
+  const auto loaded = index.GetMemoryUsage();
+
+  // a pinned snapshot keeps all the overwritten versions
+  const auto snapshot = index.GetSnapshot();
+  for (size_t j = 0; j < kOverwriteNum; ++j) {
+    for (uint64_t i = 0; i < kRecNum; ++i) {
+      index.Write(i, i + j);
+    }
+  }
+  const auto version_size = sizeof(std::pair<uint64_t, std::optional<uint64_t>>);
+  EXPECT_GE(index.GetMemoryUsage(), loaded + kRecNum * kOverwriteNum * version_size);
+  index.ReleaseSnapshot(snapshot);
+}
+
+}  // namespace dbgroup::index::test
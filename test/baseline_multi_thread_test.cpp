@@ -0,0 +1,43 @@
+/*
+ * Copyright 2026 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include <dbgroup/index_fixtures/baseline_indexes.hpp>
+
+// external libraries
+#include <dbgroup/index_fixtures/index_fixture_multi_thread.hpp>
+
+namespace dbgroup::index::test
+{
+/*############################################################################*
+ * Preparation for typed testing
+ *############################################################################*/
+
+using TestTargets = ::testing::Types<             //
+    IndexInfo<ShardedMapIndex, UInt8, UInt8>,     // sharded std::map
+    IndexInfo<ShardedMapIndex, Var, UInt4>,       // sharded std::map/varlen keys
+    IndexInfo<SortedArrayIndex, Var, UInt8>,      // sorted array/varlen keys
+    IndexInfo<OpenAddressingIndex, UInt8, UInt4>  // hash table
+    >;
+TYPED_TEST_SUITE(IndexMultiThreadFixture, TestTargets);
+
+/*############################################################################*
+ * Unit test definitions
+ *############################################################################*/
+
+#include "dbgroup/index_fixtures/index_fixture_multi_thread_test_definitions.hpp"
+
+}  // namespace dbgroup::index::test
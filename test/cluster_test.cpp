@@ -0,0 +1,176 @@
+/*
+ * Copyright 2026 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include <dbgroup/index_fixtures/cluster.hpp>
+
+// C++ standard libraries
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+// system libraries
+#include <unistd.h>
+
+// external libraries
+#include <gtest/gtest.h>
+
+// local sources
+#include <dbgroup/index_fixtures/metrics.hpp>
+
+namespace dbgroup::index::test
+{
+/*############################################################################*
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kTestNodeNum = 4;
+
+/*############################################################################*
+ * Unit test definitions
+ *############################################################################*/
+
+TEST(LocalClusterTest, LaunchAssignsNodeIDsAndAggregatesMetrics)
+{
+  LocalCluster cluster{kTestNodeNum};
+  const auto rc = cluster.Launch([](const size_t node_id) {
+    if (NodeContext::GetNodeID() != node_id) return 1;
+    NodeContext::ReportMetric("node_id", static_cast<double>(node_id));
+    NodeContext::ReportMetric("count", 1);
+    return 0;
+  });
+  cluster.Report();
+
+  EXPECT_EQ(rc, 0);
+  EXPECT_DOUBLE_EQ(cluster.GetTotal("count"), kTestNodeNum);
+  const auto& node_ids = cluster.GetResults().at("node_id");
+  ASSERT_EQ(node_ids.size(), kTestNodeNum);
+  for (size_t i = 0; i < kTestNodeNum; ++i) {
+    EXPECT_DOUBLE_EQ(node_ids[i], i);
+  }
+}
+
+TEST(LocalClusterTest, RoundTripsPerOpAreComputedAfterAggregation)
+{
+  LocalCluster cluster{kTestNodeNum};
+  const auto rc = cluster.Launch([](const size_t node_id) {
+    // node i executes (i + 1) operations with two round trips for each
+    const auto ops = static_cast<double>(node_id + 1);
+    NodeContext::ReportMetric(std::string{"test"} + kRoundTripsSuffix, 2 * ops);
+    NodeContext::ReportMetric(std::string{"test"} + kOpsSuffix, ops);
+    return 0;
+  });
+  cluster.Report();
+
+  ASSERT_EQ(rc, 0);
+  EXPECT_DOUBLE_EQ(cluster.GetRoundTripsPerOp("test"), 2);
+}
+
+TEST(LocalClusterTest, LaunchReportsFailedNodes)
+{
+  LocalCluster cluster{kTestNodeNum};
+  const auto rc = cluster.Launch([](const size_t node_id) {  //
+    return (node_id == kTestNodeNum - 1) ? 1 : 0;
+  });
+
+  EXPECT_EQ(rc, 1);
+}
+
+TEST(LocalClusterTest, BarrierReleasesAllNodesWithSameStartTime)
+{
+  constexpr size_t kRepeatNum = 3;
+
+  LocalCluster cluster{kTestNodeNum};
+  const auto rc = cluster.Launch([](const size_t node_id) {
+    for (size_t i = 0; i < kRepeatNum; ++i) {
+      std::this_thread::sleep_for(std::chrono::milliseconds{10 * node_id});
+      const auto arrival = GetTimestamp();
+      const auto start = NodeContext::Barrier();
+      const auto now = GetTimestamp();
+      const auto id = std::to_string(i);
+      NodeContext::ReportMetric("arrival_" + id, static_cast<double>(arrival));
+      NodeContext::ReportMetric("start_" + id, static_cast<double>(start));
+      NodeContext::ReportMetric("early_" + id, (now < start) ? 1 : 0);
+    }
+    return 0;
+  });
+
+  ASSERT_EQ(rc, 0);
+  for (size_t i = 0; i < kRepeatNum; ++i) {
+    const auto id = std::to_string(i);
+    const auto& arrivals = cluster.GetResults().at("arrival_" + id);
+    const auto& starts = cluster.GetResults().at("start_" + id);
+    const auto last_arrival = *std::max_element(arrivals.begin(), arrivals.end());
+    for (const auto start : starts) {
+      EXPECT_DOUBLE_EQ(start, starts.front());
+      EXPECT_GE(start, last_arrival);
+    }
+    EXPECT_DOUBLE_EQ(cluster.GetTotal("early_" + id), 0);
+  }
+}
+
+TEST(LocalClusterTest, BarrierIsNotBlockedByFinishedNodes)
+{
+  LocalCluster cluster{kTestNodeNum};
+  const auto rc = cluster.Launch([](const size_t node_id) {
+    if (node_id == 0) return 0;
+    NodeContext::Barrier();
+    NodeContext::ReportMetric("passed", 1);
+    return 0;
+  });
+
+  EXPECT_EQ(rc, 0);
+  EXPECT_TRUE(cluster.IsValid());
+  EXPECT_DOUBLE_EQ(cluster.GetTotal("passed"), kTestNodeNum - 1);
+}
+
+TEST(LocalClusterTest, BarrierFailsIfNodeDisconnectsEarly)
+{
+  LocalCluster cluster{kTestNodeNum};
+  const auto rc = cluster.Launch([](const size_t node_id) {
+    if (node_id == 0) ::_exit(0);  // emulate a crash without leaving
+    try {
+      NodeContext::Barrier();
+    } catch (const std::runtime_error&) {
+      NodeContext::ReportMetric("aborted", 1);
+    }
+    return 0;
+  });
+  cluster.Report();
+
+  EXPECT_EQ(rc, 1);
+  EXPECT_FALSE(cluster.IsValid());
+  EXPECT_DOUBLE_EQ(cluster.GetTotal("aborted"), kTestNodeNum - 1);
+}
+
+TEST(LocalClusterTest, LaunchWithSingleNodeRunsInProcess)
+{
+  LocalCluster cluster{1};
+  size_t executed = 0;
+  const auto rc = cluster.Launch([&](const size_t) {
+    ++executed;
+    return 0;
+  });
+
+  EXPECT_EQ(rc, 0);
+  EXPECT_EQ(executed, 1);
+  EXPECT_FALSE(NodeContext::IsConnected());
+}
+
+}  // namespace dbgroup::index::test
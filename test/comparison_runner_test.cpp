@@ -0,0 +1,136 @@
+/*
+ * Copyright 2026 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include <dbgroup/index_fixtures/comparison_runner.hpp>
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <string>
+#include <utility>
+
+// external libraries
+#include <gtest/gtest.h>
+
+// local sources
+#include <dbgroup/index_fixtures/baseline_indexes.hpp>
+
+namespace dbgroup::index::test
+{
+/*############################################################################*
+ * Preparation for typed testing
+ *############################################################################*/
+
+using TestTargets = ::testing::Types<              //
+    IndexInfo<ShardedMapIndex, UInt8, UInt8>,      // sharded std::map
+    IndexInfo<SortedArrayIndex, UInt8, UInt8>,     // sorted array
+    IndexInfo<OpenAddressingIndex, UInt8, UInt8>,  // hash table
+    IndexInfo<ShardedMapIndex, Var, UInt8>,        // sharded std::map/varlen keys
+    IndexInfo<SortedArrayIndex, Var, UInt8>        // sorted array/varlen keys
+    >;
+
+/**
+ * @tparam IndexInfo A target index with its key/payload types.
+ * @return The number of workload phases that the target runs.
+ */
+template <class IndexInfo>
+constexpr auto
+GetPhaseNum()  //
+    -> size_t
+{
+  using Key = typename IndexInfo::Key::Data;
+  using Payload = typename IndexInfo::Payload::Data;
+  using Index = typename IndexInfo::Index;
+
+  if constexpr (!HasWrite<Index, Key, Payload>() && !HasInsert<Index, Key, Payload>()
+                && !HasBulkload<Index, Key, Payload>()) {
+    return 0;
+  } else {
+    return 1  // load
+           + (HasRead<Index, Key, Payload>() ? 1 : 0) + (HasUpdate<Index, Key, Payload>() ? 1 : 0)
+           + (HasScan<Index, Key, Payload>() ? 1 : 0) + (HasDelete<Index, Key, Payload>() ? 1 : 0);
+  }
+}
+
+template <class... IndexInfos>
+constexpr auto
+GetPhaseNum(  //
+    ::testing::Types<IndexInfos...>)  //
+    -> size_t
+{
+  return (GetPhaseNum<IndexInfos>() + ...);
+}
+
+/*############################################################################*
+ * Unit test definitions
+ *############################################################################*/
+
+TEST(ComparisonRunnerTest, CompareBaselineIndexesSideBySide)
+{
+  ComparisonRunner<TestTargets> runner{};
+  runner.Run();
+  runner.PrintTable();
+
+  const auto& results = runner.GetResults();
+  ASSERT_EQ(results.size(), GetPhaseNum(TestTargets{}));
+  for (const auto& r : results) {
+    EXPECT_EQ(r.ops, kExecNum);
+    EXPECT_GT(r.throughput, 0);
+    EXPECT_LE(r.p50, r.p99);
+    EXPECT_LE(r.p99, r.p999);
+  }
+
+  // the first target of each key/payload group is the baseline of relative throughput
+  std::set<std::pair<std::string, std::string>> groups{};
+  for (size_t i = 0; i < results.size(); ++i) {
+    const auto& r = results[i];
+    groups.emplace(r.key, r.payload);
+    bool is_first = true;
+    for (size_t j = 0; j < i; ++j) {
+      const auto& prev = results[j];
+      if (prev.key == r.key && prev.payload == r.payload && prev.phase == r.phase) {
+        is_first = false;
+        EXPECT_DOUBLE_EQ(r.relative, r.throughput / prev.throughput);
+        break;
+      }
+    }
+    if (is_first) {
+      EXPECT_DOUBLE_EQ(r.relative, 1.0);
+    }
+  }
+  EXPECT_EQ(groups.size(), 2);
+
+  const auto csv_path = ::testing::TempDir() + "comparison_runner_test.csv";
+  runner.WriteCSV(csv_path);
+  std::ifstream csv{csv_path};
+  size_t line_num = 0;
+  for (std::string line{}; std::getline(csv, line);) {
+    ++line_num;
+  }
+  EXPECT_EQ(line_num, results.size() + 1);
+
+  const auto json_path = ::testing::TempDir() + "comparison_runner_test.json";
+  runner.WriteJSON(json_path);
+  EXPECT_TRUE(std::ifstream{json_path}.good());
+
+  std::remove(csv_path.c_str());
+  std::remove(json_path.c_str());
+}
+
+}  // namespace dbgroup::index::test
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2026 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// C++ standard libraries
+#include <array>
+#include <cstddef>
+
+// external libraries
+#include <gtest/gtest.h>
+
+// local sources
+#include <dbgroup/index_fixtures/common.hpp>
+
+namespace dbgroup::index::test
+{
+/*############################################################################*
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kTestNodeNum = 4;
+
+constexpr size_t kTestKeyNum = 10000;
+
+constexpr size_t kTestRemotePercent = 20;
+
+/*############################################################################*
+ * Utility functions
+ *############################################################################*/
+
+/**
+ * @param policy A key-partitioning policy.
+ * @return The number of keys accessed by each node.
+ */
+auto
+CountKeys(  //
+    const KeyPartition policy)  //
+    -> std::array<size_t, kTestNodeNum>
+{
+  std::array<size_t, kTestNodeNum> counts{};
+  for (size_t id = 0; id < kTestKeyNum; ++id) {
+    const auto node = GetOwnerNode(id, policy, kTestNodeNum, kTestKeyNum, kTestRemotePercent);
+    EXPECT_LT(node, kTestNodeNum);
+    if (node < kTestNodeNum) {
+      ++counts[node];
+    }
+  }
+  return counts;
+}
+
+/*############################################################################*
+ * Unit test definitions
+ *############################################################################*/
+
+TEST(KeyPartitionTest, RangePartitionAssignsContiguousKeys)
+{
+  for (const auto count : CountKeys(kRangePartition)) {
+    EXPECT_EQ(count, kTestKeyNum / kTestNodeNum);
+  }
+
+  size_t prev = 0;
+  for (size_t id = 0; id < kTestKeyNum; ++id) {
+    const auto node = GetOwnerNode(id, kRangePartition, kTestNodeNum, kTestKeyNum);
+    EXPECT_GE(node, prev);
+    prev = node;
+  }
+}
+
+TEST(KeyPartitionTest, HashPartitionBalancesKeys)
+{
+  for (const auto count : CountKeys(kHashPartition)) {
+    EXPECT_NEAR(count, kTestKeyNum / kTestNodeNum, kTestKeyNum / kTestNodeNum / 10);
+  }
+}
+
+TEST(KeyPartitionTest, SkewedPartitionAccessesRemoteKeys)
+{
+  constexpr size_t kPartSize = kTestKeyNum / kTestNodeNum;
+
+  std::array<size_t, kTestNodeNum> remote{};
+  for (size_t id = 0; id < kTestKeyNum; ++id) {
+    const auto node = GetOwnerNode(id, kSkewedPartition, kTestNodeNum, kTestKeyNum,  //
+                                   kTestRemotePercent);
+    if (node != GetOwnerNode(id, kRangePartition, kTestNodeNum, kTestKeyNum)) {
+      ++remote[node];
+    }
+  }
+
+  for (size_t i = 0; i < kTestNodeNum; ++i) {
+    EXPECT_EQ(remote[i], kPartSize * kTestRemotePercent / 100);
+  }
+  for (const auto count : CountKeys(kSkewedPartition)) {
+    EXPECT_EQ(count, kPartSize);
+  }
+}
+
+}  // namespace dbgroup::index::test
@@ -0,0 +1,42 @@
+/*
+ * Copyright 2026 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include <dbgroup/index_fixtures/baseline_indexes.hpp>
+
+// external libraries
+#include <dbgroup/index_fixtures/index_fixture_multimap.hpp>
+
+namespace dbgroup::index::test
+{
+/*############################################################################*
+ * Preparation for typed testing
+ *############################################################################*/
+
+using TestTargets = ::testing::Types<        //
+    IndexInfo<MultiMapIndex, UInt8, UInt8>,  // fixed-length keys
+    IndexInfo<MultiMapIndex, UInt4, UInt4>,  // small keys/small payloads
+    IndexInfo<MultiMapIndex, Var, UInt8>     // varlen keys
+    >;
+TYPED_TEST_SUITE(MultiMapIndexFixture, TestTargets);
+
+/*############################################################################*
+ * Unit test definitions
+ *############################################################################*/
+
+#include "dbgroup/index_fixtures/index_fixture_multimap_test_definitions.hpp"
+
+}  // namespace dbgroup::index::test
@@ -0,0 +1,177 @@
+/*
+ * Copyright 2026 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include <dbgroup/index_fixtures/transport.hpp>
+
+// C++ standard libraries
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+// external libraries
+#include <gtest/gtest.h>
+
+// local sources
+#include <dbgroup/index_fixtures/cluster.hpp>
+#include <dbgroup/index_fixtures/metrics.hpp>
+
+namespace dbgroup::index::test
+{
+/*############################################################################*
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kTestNodeNum = 2;
+
+constexpr size_t kCallNum = 100;
+
+/*############################################################################*
+ * Utility functions
+ *############################################################################*/
+
+/**
+ * @brief Echo requests from node 1 to node 0 and report the mean RTT.
+ *
+ * @param config Parameters of an emulated network.
+ * @param req_size The size of each request.
+ * @param call_num The number of calls.
+ * @return The status code of the launched cluster.
+ */
+auto
+RunEcho(  //
+    LocalCluster& cluster,
+    const NetworkConfig& config,
+    const size_t req_size,
+    const size_t call_num)  //
+    -> int
+{
+  return cluster.Launch([&](const size_t node_id) {
+    LoopbackTransport transport{config, node_id, kTestNodeNum};
+    transport.Serve([](size_t, const std::string& req) { return req; });
+    NodeContext::Barrier();
+
+    if (node_id == 1) {
+      const std::string req(req_size, 'a');
+      const auto begin = GetTimestamp();
+      for (size_t i = 0; i < call_num; ++i) {
+        if (transport.Call(0, req) != req) return 1;
+      }
+      const auto rtt = static_cast<double>(GetTimestamp() - begin) / call_num;
+      NodeContext::ReportMetric("rtt", rtt);
+      NodeContext::ReportMetric("round_trips", LoopbackTransport::GetRoundTrips());
+    }
+
+    NodeContext::Barrier();  // keep the server running until all calls finish
+    return 0;
+  });
+}
+
+/*############################################################################*
+ * Unit test definitions
+ *############################################################################*/
+
+TEST(LoopbackTransportTest, CallDelaysMessagesByEmulatedRTT)
+{
+  constexpr uint64_t kRTT = 200000;  // 200 us
+  constexpr uint64_t kJitter = 20000;
+
+  LocalCluster cluster{kTestNodeNum};
+  ASSERT_EQ(RunEcho(cluster, {kRTT, kJitter, 0}, 8, kCallNum), 0);
+  cluster.Report();
+
+  EXPECT_GE(cluster.GetTotal("rtt"), kRTT);
+  EXPECT_DOUBLE_EQ(cluster.GetTotal("round_trips"), kCallNum);
+}
+
+TEST(LoopbackTransportTest, CallDelaysMessagesByBandwidth)
+{
+  constexpr uint64_t kBandwidth = 10;  // 10 MB/s
+  constexpr size_t kReqSize = 32 * 1024;
+  constexpr size_t kCallNum = 10;
+
+  LocalCluster cluster{kTestNodeNum};
+  ASSERT_EQ(RunEcho(cluster, {0, 0, kBandwidth}, kReqSize, kCallNum), 0);
+  cluster.Report();
+
+  // a request and its response are transferred on each call
+  EXPECT_GE(cluster.GetTotal("rtt"), 2.0 * kReqSize * 1000 / kBandwidth);
+}
+
+TEST(LoopbackTransportTest, ConcurrentCallsAreHandledInParallel)
+{
+  constexpr uint64_t kRTT = 200000;  // 200 us
+  constexpr uint64_t kHandleTime = 5000000;  // 5 ms
+  constexpr size_t kClientNum = 4;
+  constexpr size_t kCallNum = 5;
+
+  LocalCluster cluster{1};
+  const auto rc = cluster.Launch([&](size_t) {
+    LoopbackTransport server{{kRTT, 0, 0}, 0, kTestNodeNum};
+    server.Serve([&](size_t, const std::string& req) {
+      std::this_thread::sleep_for(std::chrono::nanoseconds{kHandleTime});
+      return req;
+    });
+    LoopbackTransport client{{kRTT, 0, 0}, 1, kTestNodeNum};
+
+    const auto begin = GetTimestamp();
+    std::vector<std::thread> threads{};
+    for (size_t i = 0; i < kClientNum; ++i) {
+      threads.emplace_back([&] {
+        for (size_t j = 0; j < kCallNum; ++j) {
+          client.Call(0, "");
+        }
+      });
+    }
+    for (auto&& t : threads) {
+      t.join();
+    }
+    const auto elapsed = GetTimestamp() - begin;
+
+    // a server handling requests one by one would take all the handling time
+    return (elapsed < kClientNum * kCallNum * kHandleTime) ? 0 : 1;
+  });
+  ASSERT_EQ(rc, 0);
+}
+
+TEST(LoopbackTransportTest, CallReceivesResponsesOnlyFromDestination)
+{
+  LocalCluster cluster{1};
+  const auto rc = cluster.Launch([](size_t) {
+    LoopbackTransport transport_a{{}, 0, kTestNodeNum};
+    transport_a.Serve([](size_t, const std::string&) { return std::string{"a"}; });
+    {
+      LoopbackTransport transport_b{{}, 1, kTestNodeNum};
+      transport_b.Serve([](size_t, const std::string&) { return std::string{"b"}; });
+      for (size_t i = 0; i < kCallNum; ++i) {
+        if (transport_a.Call(1, "") != "b" || transport_b.Call(0, "") != "a") return 1;
+      }
+    }
+
+    // a new transport must not reuse the client sockets of destroyed ones
+    LoopbackTransport transport_c{{}, 1, kTestNodeNum};
+    for (size_t i = 0; i < kCallNum; ++i) {
+      if (transport_c.Call(0, "") != "a") return 1;
+    }
+    return 0;
+  });
+  ASSERT_EQ(rc, 0);
+}
+
+}  // namespace dbgroup::index::test